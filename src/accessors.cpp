@@ -14,10 +14,13 @@ void S21Matrix::SetRows(int new_rows) {
 
     this->rows_ = T.rows_;
     this->cols_ = T.cols_;
+    this->stride_ = T.stride_;
+    this->data_ = T.data_;
     this->matrix_ = T.matrix_;
 
     T.rows_ = 0;
     T.cols_ = 0;
+    T.data_ = nullptr;
     T.matrix_ = nullptr;
   }
 }
@@ -36,10 +39,13 @@ void S21Matrix::SetCols(int new_cols) {
 
     this->rows_ = T.rows_;
     this->cols_ = T.cols_;
+    this->stride_ = T.stride_;
+    this->data_ = T.data_;
     this->matrix_ = T.matrix_;
 
     T.rows_ = 0;
     T.cols_ = 0;
+    T.data_ = nullptr;
     T.matrix_ = nullptr;
   }
 }
\ No newline at end of file
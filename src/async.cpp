@@ -0,0 +1,35 @@
+#include "s21_executor.h"
+#include "s21_matrix_oop.h"
+
+std::future<S21Matrix> S21Matrix::SumMatrixAsync(
+    const S21Matrix& other) const {
+  return S21Executor::Instance().Async(
+      [a = *this, b = other]() { return a + b; });
+}
+
+std::future<S21Matrix> S21Matrix::SubMatrixAsync(
+    const S21Matrix& other) const {
+  return S21Executor::Instance().Async(
+      [a = *this, b = other]() { return a - b; });
+}
+
+std::future<S21Matrix> S21Matrix::MulMatrixAsync(
+    const S21Matrix& other) const {
+  return S21Executor::Instance().Async(
+      [a = *this, b = other]() { return a * b; });
+}
+
+std::future<S21Matrix> S21Matrix::InverseAsync() const {
+  return S21Executor::Instance().Async(
+      [a = *this]() { return a.InverseMatrix(); });
+}
+
+std::future<double> S21Matrix::DeterminantAsync() const {
+  return S21Executor::Instance().Async(
+      [a = *this]() { return a.Determinant(); });
+}
+
+std::future<S21Matrix> S21Matrix::SolveAsync(const S21Matrix& b) const {
+  return S21Executor::Instance().Async(
+      [a = *this, b]() { return a.Solve(b); });
+}
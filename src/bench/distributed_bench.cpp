@@ -0,0 +1,98 @@
+// Слабое масштабирование SUMMA и распределённого LU. Размер растёт как
+// n0 * P^(1/3), так что на процесс приходится столько же операций, сколько
+// в задаче n0 x n0 на одном процессе. Эффективность — время такой задачи
+// локально (все процессы считают её одновременно), делённое на время
+// распределённой. Запуск:
+//   S21_NUM_THREADS=1 mpiexec -np 4 ./distributed_bench [n0] [block] [reps]
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "../s21_distributed.h"
+
+namespace {
+
+S21Matrix MakeMatrix(int n, int seed) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    double* row = m.Row(i);
+    for (int j = 0; j < n; ++j) {
+      row[j] = std::sin(0.37 * i + 0.11 * j + seed) + (i == j ? n : 0.0);
+    }
+  }
+  return m;
+}
+
+// Наибольшее по процессам время лучшего из reps запусков
+template <class Body>
+double Time(int reps, Body body) {
+  double best = 1e300;
+  for (int r = 0; r < reps; ++r) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start = MPI_Wtime();
+    body();
+    double elapsed = MPI_Wtime() - start;
+    MPI_Allreduce(MPI_IN_PLACE, &elapsed, 1, MPI_DOUBLE, MPI_MAX,
+                  MPI_COMM_WORLD);
+    best = std::min(best, elapsed);
+  }
+  return best;
+}
+
+void Report(const char* name, int n, double flops, double local_time,
+            double time) {
+  std::cout << std::left << std::setw(8) << name << std::right
+            << std::setw(8) << n << std::fixed << std::setprecision(4)
+            << std::setw(12) << local_time << std::setw(12) << time
+            << std::setprecision(2) << std::setw(10) << flops / time * 1e-9
+            << std::setw(8) << 100.0 * local_time / time << "%\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  MPI_Init(&argc, &argv);
+  int n0 = argc > 1 ? std::atoi(argv[1]) : 512;
+  int block = argc > 2 ? std::atoi(argv[2]) : 64;
+  int reps = argc > 3 ? std::atoi(argv[3]) : 3;
+  {
+    S21ProcessGrid grid;
+    int size = grid.Size();
+    int n = static_cast<int>(std::lround(n0 * std::cbrt(size)));
+    n = std::max(n, block * std::max(grid.GetRows(), grid.GetCols()));
+
+    S21Matrix a0 = MakeMatrix(n0, 1), b0 = MakeMatrix(n0, 2);
+    double gemm_local = Time(reps, [&] { S21Matrix c = a0 * b0; });
+    double lu_local = Time(reps, [&] {
+      S21Matrix copy(a0);
+      copy.SetCacheEnabled(false);
+      static_cast<void>(copy.Determinant());
+    });
+
+    S21Matrix a = grid.Rank() == 0 ? MakeMatrix(n, 1) : S21Matrix(1, 1);
+    S21Matrix b = grid.Rank() == 0 ? MakeMatrix(n, 2) : S21Matrix(1, 1);
+    auto da = S21DistributedMatrix::Scatter(grid, a, n, n, block);
+    auto db = S21DistributedMatrix::Scatter(grid, b, n, n, block);
+    double gemm = Time(reps, [&] { S21DistributedMatrix::Multiply(da, db); });
+    double lu = Time(reps, [&] { da.LU(); });
+
+    if (grid.Rank() == 0) {
+      std::cout << "# ranks " << size << " (grid " << grid.GetRows() << " x "
+                << grid.GetCols() << "), n0 " << n0 << ", block " << block
+                << '\n'
+                << std::left << std::setw(8) << "op" << std::right
+                << std::setw(8) << "n" << std::setw(12) << "local_s"
+                << std::setw(12) << "dist_s" << std::setw(10) << "GFLOP/s"
+                << std::setw(9) << "weak_eff" << '\n';
+      double nd = n;
+      Report("SUMMA", n, 2.0 * nd * nd * nd, gemm_local, gemm);
+      Report("LU", n, 2.0 / 3.0 * nd * nd * nd, lu_local, lu);
+    }
+  }
+  MPI_Finalize();
+  return 0;
+}
@@ -0,0 +1,86 @@
+// Тайловые LU и Холецкий против параллельного Gemm того же размера.
+// Доля — скорость разложения в GFLOP/s, делённая на скорость Gemm.
+// Запуск:
+//   S21_NUM_THREADS=32 ./tiled_bench [n] [tile] [reps]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_parallel.h"
+#include "../s21_tiled.h"
+
+namespace {
+
+S21Matrix MakeMatrix(int n, int seed) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; ++i) {
+    double* row = m.Row(i);
+    for (int j = 0; j < n; ++j) {
+      row[j] = std::sin(0.37 * i + 0.11 * j + seed) + (i == j ? n : 0.0);
+    }
+  }
+  return m;
+}
+
+// Лучшее из reps время; prepare не входит в замер
+template <class Prepare, class Body>
+double Time(int reps, Prepare prepare, Body body) {
+  double best = 1e300;
+  for (int r = 0; r < reps; ++r) {
+    prepare();
+    auto start = std::chrono::steady_clock::now();
+    body();
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    best = std::min(best, elapsed.count());
+  }
+  return best;
+}
+
+void Report(const char* name, double flops, double time, double gemm_rate) {
+  double rate = flops / time * 1e-9;
+  std::cout << std::left << std::setw(10) << name << std::right << std::fixed
+            << std::setprecision(4) << std::setw(12) << time
+            << std::setprecision(2) << std::setw(10) << rate << std::setw(8)
+            << 100.0 * rate / gemm_rate << "%\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : S21Tiled::kMinSize;
+  int tile = argc > 2 ? std::atoi(argv[2]) : S21Tiled::kTile;
+  int reps = argc > 3 ? std::atoi(argv[3]) : 3;
+  const S21Matrix a = MakeMatrix(n, 1), b = MakeMatrix(n, 2);
+  S21Matrix c(n, n), work(n, n);
+  std::vector<double*> rows(n);
+  std::vector<int> pivots(n);
+  auto reset = [&] {
+    work = a;
+    for (int i = 0; i < n; ++i) rows[i] = work.Row(i);
+  };
+
+  double n3 = 1.0 * n * n * n;
+  double gemm = Time(reps, [] {}, [&] { c.Gemm(1.0, a, b, 0.0); });
+  double gemm_rate = 2.0 * n3 / gemm * 1e-9;
+  double lu = Time(reps, reset, [&] {
+    S21Tiled::LU(rows.data(), n, pivots.data(), 0.0, tile);
+  });
+  double cholesky =
+      Time(reps, reset, [&] { S21Tiled::Cholesky(rows.data(), n, tile); });
+
+  std::cout << "n = " << n << ", tile = " << tile
+            << ", threads = " << S21ThreadCount() << "\n"
+            << std::left << std::setw(10) << "op" << std::right
+            << std::setw(12) << "time, s" << std::setw(10) << "GFLOP/s"
+            << std::setw(9) << "of Gemm\n";
+  Report("Gemm", 2.0 * n3, gemm, gemm_rate);
+  Report("LU", 2.0 * n3 / 3.0, lu, gemm_rate);
+  Report("Cholesky", n3 / 3.0, cholesky, gemm_rate);
+  return 0;
+}
@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+// Минимальное число элементов матрицы на один поток
+constexpr int kParallelElements = 1 << 15;
+
+// Скалярное произведение с четырьмя аккумуляторами, чтобы цикл
+// векторизовался без -ffast-math
+double Dot(const double* a, const double* b, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    s0 += a[j] * b[j];
+    s1 += a[j + 1] * b[j + 1];
+    s2 += a[j + 2] * b[j + 2];
+    s3 += a[j + 3] * b[j + 3];
+  }
+  for (; j < n; ++j) s0 += a[j] * b[j];
+  return (s0 + s1) + (s2 + s3);
+}
+
+// y += alpha * x
+void Axpy(double alpha, const double* x, double* y, int n) {
+  for (int j = 0; j < n; ++j) y[j] += alpha * x[j];
+}
+
+int RowGrain(int cols) {
+  return std::max(1, kParallelElements / std::max(cols, 1));
+}
+
+// Верхняя граница числа блоков частичных сумм в транспонированном Gemv
+constexpr int kMaxBlocks = 64;
+
+// Длина блока по k: блок строк B должен оставаться в кэше
+constexpr int kBlockK = 128;
+
+}  // namespace
+
+void S21Matrix::Gemv(double alpha, const S21Vector& x, double beta,
+                     S21Vector& y, bool transpose) const {
+  int x_size = transpose ? rows_ : cols_;
+  int y_size = transpose ? cols_ : rows_;
+  S21_TELEMETRY_SCOPE(S21Op::kGemv, 1LL * rows_ * cols_,
+                      8LL * (1LL * rows_ * cols_ + x_size + 2LL * y_size),
+                      2LL * rows_ * cols_);
+  if (x.GetSize() != x_size || y.GetSize() != y_size) {
+    throw std::logic_error("Vector size does not match matrix dimensions");
+  }
+  if (&x == &y) {
+    throw std::invalid_argument("Input and output vectors must not alias");
+  }
+
+  const double* xs = x.Data();
+  double* ys = y.Data();
+  for (int i = 0; i < y_size; ++i) ys[i] = beta == 0.0 ? 0.0 : beta * ys[i];
+
+  if (!transpose) {
+    S21ParallelFor(0, rows_, RowGrain(cols_), [&](int from, int to) {
+      for (int i = from; i < to; ++i) {
+        ys[i] += alpha * Dot(matrix_[i], xs, cols_);
+      }
+    });
+  } else {
+    // A^T x как сумма строк A с весами x_i: строки читаются подряд,
+    // каждый блок строк копит частичную сумму в своей части буфера.
+    // Блоки не зависят от числа потоков и складываются по порядку,
+    // поэтому результат одинаков при любом S21_NUM_THREADS
+    int per = std::max(RowGrain(cols_), (rows_ + kMaxBlocks - 1) / kMaxBlocks);
+    int blocks = (rows_ + per - 1) / per;
+    std::vector<double> partial(1LL * blocks * cols_, 0.0);
+    S21ParallelFor(0, blocks, 1, [&](int from, int to) {
+      for (int b = from; b < to; ++b) {
+        double* sum = partial.data() + 1LL * b * cols_;
+        int end = std::min(rows_, (b + 1) * per);
+        for (int i = b * per; i < end; ++i) {
+          Axpy(alpha * xs[i], matrix_[i], sum, cols_);
+        }
+      }
+    });
+    for (int b = 0; b < blocks; ++b) {
+      Axpy(1.0, partial.data() + 1LL * b * cols_, ys, cols_);
+    }
+  }
+}
+
+S21Vector S21Matrix::MulVector(const S21Vector& x) const {
+  S21Vector y(rows_);
+  Gemv(1.0, x, 0.0, y);
+  return y;
+}
+
+S21Vector S21Matrix::MulVectorTransposed(const S21Vector& x) const {
+  S21Vector y(cols_);
+  Gemv(1.0, x, 0.0, y, true);
+  return y;
+}
+
+void S21Matrix::Gemm(double alpha, const S21Matrix& a, const S21Matrix& b,
+                     double beta, bool trans_a, bool trans_b) {
+  int m = trans_a ? a.cols_ : a.rows_;
+  int k = trans_a ? a.rows_ : a.cols_;
+  int kb = trans_b ? b.cols_ : b.rows_;
+  int n = trans_b ? b.rows_ : b.cols_;
+  if (k != kb) {
+    throw std::logic_error("Cols must be equal rows other matrix");
+  }
+  if (rows_ != m || cols_ != n) {
+    throw std::logic_error("Result matrix has wrong dimensions");
+  }
+  if (&a == this || &b == this) {
+    // Результат перекрывается с операндом: считаем через копию
+    S21Matrix operand(*this);
+    Gemm(alpha, &a == this ? operand : a, &b == this ? operand : b, beta,
+         trans_a, trans_b);
+    return;
+  }
+  S21_TELEMETRY_SCOPE(S21Op::kGemm, 1LL * m * n,
+                      8LL * (1LL * m * k + 1LL * k * n +
+                             (beta == 0.0 ? 1LL : 2LL) * m * n),
+                      2LL * m * n * k);
+  Detach();
+  InvalidateCache();
+
+  double** am = a.matrix_;
+  double** bm = b.matrix_;
+  long long row_work = std::max(1LL, static_cast<long long>(n) * k);
+  int grain = static_cast<int>(
+      std::max(1LL, 8LL * kParallelElements / row_work));
+  S21ParallelFor(0, m, grain, [&](int from, int to) {
+    for (int i = from; i < to; ++i) {
+      double* c = matrix_[i];
+      // beta применяется к строке C прямо перед накоплением, пока
+      // она в кэше, поэтому C проходится один раз
+      for (int j = 0; j < n; ++j) c[j] = beta == 0.0 ? 0.0 : beta * c[j];
+      if (alpha == 0.0) continue;
+      if (!trans_b) {
+        for (int p = 0; p < k; ++p) {
+          // Нулевые a_ip не пропускаются: 0 * inf и 0 * nan из B
+          // должны дойти до C, как в обычном произведении
+          double aip = alpha * (trans_a ? am[p][i] : am[i][p]);
+          Axpy(aip, bm[p], c, n);
+        }
+      } else if (!trans_a) {
+        for (int j = 0; j < n; ++j) c[j] += alpha * Dot(am[i], bm[j], k);
+      } else {
+        for (int p0 = 0; p0 < k; p0 += kBlockK) {
+          int p1 = std::min(k, p0 + kBlockK);
+          for (int j = 0; j < n; ++j) {
+            double sum = 0.0;
+            for (int p = p0; p < p1; ++p) sum += am[p][i] * bm[j][p];
+            c[j] += alpha * sum;
+          }
+        }
+      }
+    }
+  });
+}
@@ -0,0 +1,139 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+// Вычисляет произведение по найденной расстановке скобок.
+// Освободившиеся промежуточные матрицы переиспользуются, если
+// следующий результат имеет тот же размер
+class ChainEvaluator {
+ public:
+  ChainEvaluator(const std::vector<const S21Matrix*>& chain,
+                 const std::vector<std::vector<int>>& split)
+      : chain_(chain), split_(split) {}
+
+  struct Value {
+    const S21Matrix* matrix;
+    std::unique_ptr<S21Matrix> owned;
+  };
+
+  Value Evaluate(int i, int j) {
+    if (i == j) return Value{chain_[i], nullptr};
+    int k = split_[i][j];
+    Value left = Evaluate(i, k);
+    Value right = Evaluate(k + 1, j);
+    std::unique_ptr<S21Matrix> out =
+        Acquire(left.matrix->GetRows(), right.matrix->GetCols());
+    out->Gemm(1.0, *left.matrix, *right.matrix, 0.0);
+    Release(std::move(left.owned));
+    Release(std::move(right.owned));
+    const S21Matrix* result = out.get();
+    return Value{result, std::move(out)};
+  }
+
+ private:
+  std::unique_ptr<S21Matrix> Acquire(int rows, int cols) {
+    for (auto& buffer : free_) {
+      if (buffer && buffer->GetRows() == rows && buffer->GetCols() == cols) {
+        return std::move(buffer);
+      }
+    }
+    return std::make_unique<S21Matrix>(rows, cols);
+  }
+
+  void Release(std::unique_ptr<S21Matrix> buffer) {
+    if (!buffer) return;
+    for (auto& slot : free_) {
+      if (!slot) {
+        slot = std::move(buffer);
+        return;
+      }
+    }
+    free_.push_back(std::move(buffer));
+  }
+
+  const std::vector<const S21Matrix*>& chain_;
+  const std::vector<std::vector<int>>& split_;
+  std::vector<std::unique_ptr<S21Matrix>> free_;
+};
+
+// Оптимальные разбиения для цепочки с размерами dims[i] x dims[i + 1]:
+// split[i][j] — последнее умножение произведения i..j. Возвращает
+// минимальное число скалярных умножений
+double PlanSplits(const std::vector<double>& dims,
+                  std::vector<std::vector<int>>& split) {
+  int n = static_cast<int>(dims.size()) - 1;
+  // cost[i][j] — минимальное число умножений для произведения i..j
+  std::vector<std::vector<double>> cost(n, std::vector<double>(n, 0.0));
+  split.assign(n, std::vector<int>(n, 0));
+  for (int length = 2; length <= n; ++length) {
+    for (int i = 0; i + length - 1 < n; ++i) {
+      int j = i + length - 1;
+      cost[i][j] = -1.0;
+      for (int k = i; k < j; ++k) {
+        double c = cost[i][k] + cost[k + 1][j] +
+                   dims[i] * dims[k + 1] * dims[j + 1];
+        if (cost[i][j] < 0.0 || c < cost[i][j]) {
+          cost[i][j] = c;
+          split[i][j] = k;
+        }
+      }
+    }
+  }
+  return cost[0][n - 1];
+}
+
+std::string Parenthesize(const std::vector<std::vector<int>>& split, int i,
+                         int j) {
+  if (i == j) return std::to_string(i);
+  int k = split[i][j];
+  return "(" + Parenthesize(split, i, k) + " " +
+         Parenthesize(split, k + 1, j) + ")";
+}
+
+}  // namespace
+
+S21ChainPlan S21Matrix::PlanChain(const std::vector<int>& dims) {
+  if (dims.size() < 2) {
+    throw std::invalid_argument("Chain must not be empty");
+  }
+  for (int d : dims) {
+    if (d < 1) throw std::invalid_argument("Chain dimensions must be > 0");
+  }
+  std::vector<std::vector<int>> split;
+  double cost = PlanSplits(std::vector<double>(dims.begin(), dims.end()),
+                           split);
+  return {cost, Parenthesize(split, 0, static_cast<int>(dims.size()) - 2)};
+}
+
+S21Matrix S21Matrix::MulChain(const std::vector<const S21Matrix*>& chain) {
+  int n = static_cast<int>(chain.size());
+  if (n == 0) throw std::invalid_argument("Chain must not be empty");
+  for (int i = 0; i < n; ++i) {
+    if (chain[i] == nullptr) {
+      throw std::invalid_argument("Chain operand must not be null");
+    }
+    if (i > 0 && chain[i - 1]->cols_ != chain[i]->rows_) {
+      throw std::logic_error("Cols must be equal rows other matrix");
+    }
+  }
+  S21_TELEMETRY_SCOPE(S21Op::kMulChain,
+                      1LL * chain[0]->rows_ * chain[n - 1]->cols_);
+  if (n == 1) return *chain[0];
+
+  // dims[i] x dims[i + 1] — размер i-го сомножителя
+  std::vector<double> dims(n + 1);
+  dims[0] = chain[0]->rows_;
+  for (int i = 0; i < n; ++i) dims[i + 1] = chain[i]->cols_;
+
+  std::vector<std::vector<int>> split;
+  PlanSplits(dims, split);
+
+  ChainEvaluator evaluator(chain, split);
+  ChainEvaluator::Value result = evaluator.Evaluate(0, n - 1);
+  return std::move(*result.owned);
+}
@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+// Ранняя остановка проверяется раз на блок, внутри блока цикл без ветвлений
+constexpr int kBlock = 64;
+constexpr int kParallelElements = 1 << 16;
+
+std::int64_t Ordered(double x) {
+  std::int64_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  return bits < 0 ? std::numeric_limits<std::int64_t>::min() - bits : bits;
+}
+
+template <S21Tolerance Mode>
+inline double Deviation(double a, double b) {
+  // Равные бесконечности совпадают: inf - inf дал бы NaN
+  if (a == b) return 0.0;
+  if constexpr (Mode == S21Tolerance::kAbsolute) {
+    return std::fabs(a - b);
+  } else if constexpr (Mode == S21Tolerance::kRelative) {
+    double scale = std::max(std::fabs(a), std::fabs(b));
+    return scale == 0.0 ? 0.0 : std::fabs(a - b) / scale;
+  } else {
+    std::int64_t x = Ordered(a), y = Ordered(b);
+    std::uint64_t d = x > y ? static_cast<std::uint64_t>(x) - y
+                            : static_cast<std::uint64_t>(y) - x;
+    // NaN не равен ничему, в том числе самому себе
+    return (a != a || b != b) ? std::numeric_limits<double>::quiet_NaN()
+                              : static_cast<double>(d);
+  }
+}
+
+// Частичный результат по непрерывному диапазону строк
+struct Partial {
+  double max_deviation = 0.0;
+  int max_row = -1, max_col = -1;
+  int mismatch_row = -1, mismatch_col = -1;
+};
+
+template <S21Tolerance Mode>
+void CompareRows(double** a, double** b, int from, int to, int cols,
+                 double tolerance, bool stop_at_first,
+                 std::atomic<int>& first_bad_row, Partial& out) {
+  double dev[kBlock];
+  for (int i = from; i < to; ++i) {
+    if (stop_at_first && i > first_bad_row.load(std::memory_order_relaxed)) {
+      return;
+    }
+    for (int j0 = 0; j0 < cols; j0 += kBlock) {
+      int len = std::min(kBlock, cols - j0);
+      const double* ar = a[i] + j0;
+      const double* br = b[i] + j0;
+      double block_max = 0.0;
+      int bad = 0;
+      for (int j = 0; j < len; ++j) {
+        dev[j] = Deviation<Mode>(ar[j], br[j]);
+        block_max = dev[j] > block_max ? dev[j] : block_max;
+        bad |= !(dev[j] <= tolerance);
+      }
+      if (block_max > out.max_deviation || out.max_row < 0) {
+        for (int j = 0; j < len; ++j) {
+          if (dev[j] > out.max_deviation || out.max_row < 0) {
+            out.max_deviation = dev[j];
+            out.max_row = i;
+            out.max_col = j0 + j;
+          }
+        }
+      }
+      if (bad) {
+        for (int j = 0; j < len; ++j) {
+          if (dev[j] <= tolerance) continue;
+          if (out.mismatch_row < 0) {
+            out.mismatch_row = i;
+            out.mismatch_col = j0 + j;
+          }
+          if (dev[j] != dev[j] && !std::isinf(out.max_deviation)) {
+            out.max_deviation = std::numeric_limits<double>::infinity();
+            out.max_row = i;
+            out.max_col = j0 + j;
+          }
+        }
+        int seen = first_bad_row.load(std::memory_order_relaxed);
+        while (i < seen && !first_bad_row.compare_exchange_weak(seen, i)) {
+        }
+        if (stop_at_first) return;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+S21Comparison S21Matrix::Compare(const S21Matrix& other, double tolerance,
+                                 S21Tolerance mode,
+                                 bool stop_at_first) const {
+  S21_TELEMETRY_SCOPE(S21Op::kCompare, 1LL * rows_ * cols_);
+  S21Comparison result{false, std::numeric_limits<double>::infinity(),
+                       -1, -1, -1, -1};
+  if (rows_ != other.rows_ || cols_ != other.cols_) return result;
+
+  auto kernel = &CompareRows<S21Tolerance::kAbsolute>;
+  if (mode == S21Tolerance::kRelative) {
+    kernel = &CompareRows<S21Tolerance::kRelative>;
+  } else if (mode == S21Tolerance::kUlp) {
+    kernel = &CompareRows<S21Tolerance::kUlp>;
+  }
+
+  std::atomic<int> first_bad_row{rows_};
+  std::mutex guard;
+  Partial total;
+  int grain = std::max(1, kParallelElements / std::max(cols_, 1));
+  S21ParallelFor(0, rows_, grain, [&](int from, int to) {
+    Partial part;
+    kernel(matrix_, other.matrix_, from, to, cols_, tolerance, stop_at_first,
+           first_bad_row, part);
+    std::lock_guard<std::mutex> lock(guard);
+    if (part.max_row >= 0 &&
+        (total.max_row < 0 || part.max_deviation > total.max_deviation)) {
+      total.max_deviation = part.max_deviation;
+      total.max_row = part.max_row;
+      total.max_col = part.max_col;
+    }
+    if (part.mismatch_row >= 0 &&
+        (total.mismatch_row < 0 || part.mismatch_row < total.mismatch_row)) {
+      total.mismatch_row = part.mismatch_row;
+      total.mismatch_col = part.mismatch_col;
+    }
+  });
+
+  result.equal = total.mismatch_row < 0;
+  result.max_deviation = total.max_deviation;
+  result.max_row = total.max_row;
+  result.max_col = total.max_col;
+  result.mismatch_row = total.mismatch_row;
+  result.mismatch_col = total.mismatch_col;
+  return result;
+}
+
+bool S21Matrix::EqMatrix(const S21Matrix& other) const {
+  return Compare(other, 1e-7, S21Tolerance::kAbsolute, true).equal;
+}
@@ -1,45 +1,227 @@
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <utility>
+
 #include "s21_matrix_oop.h"
+#include "s21_numa.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
 // #include <algorithm> для std::copy
 
+namespace {
+
+constexpr std::align_val_t kAlignment{64};
+constexpr int kLineDoubles = 64 / sizeof(double);
+// Блок хранения: заголовок на отдельной кэш-линии, затем элементы и
+// указатели на строки. У внешнего буфера в блоке только заголовок и
+// указатели на строки, а элементы лежат в foreign
+constexpr size_t kHeaderBytes = 64;
+// Блоки строк первого касания совпадают с блоками поэлементных ядер
+constexpr int kParallelElements = 1 << 15;
+
+struct Header {
+  std::atomic<int> refs{1};
+  double* foreign = nullptr;
+  S21Matrix::Deleter deleter;
+};
+static_assert(sizeof(Header) <= kHeaderBytes, "Header must fit its line");
+
+Header& GetHeader(double* data) {
+  return *reinterpret_cast<Header*>(reinterpret_cast<char*>(data) -
+                                    kHeaderBytes);
+}
+
+std::atomic<int>& RefCount(double* data) { return GetHeader(data).refs; }
+
+// Шаг строки: широкие строки дополняются до целой кэш-линии, а шаг,
+// кратный 512 байтам, сдвигается на линию, чтобы строки не попадали
+// в одни и те же наборы кэша при обходе по столбцам
+int PaddedStride(int rows, int cols) {
+  if (rows == 1 || cols < 8 * kLineDoubles) return cols;
+  int stride = (cols + kLineDoubles - 1) / kLineDoubles * kLineDoubles;
+  if (stride % (8 * kLineDoubles) == 0) stride += kLineDoubles;
+  return stride;
+}
+
+}  // namespace
+
 void S21Matrix::CreateMatrix() {
-  matrix_ = new double*[rows_];
+  stride_ = PaddedStride(rows_, cols_);
+  size_t elements = static_cast<size_t>(rows_) * stride_;
+  size_t bytes =
+      kHeaderBytes + elements * sizeof(double) + rows_ * sizeof(double*);
+  S21_TELEMETRY_SCOPE(S21Op::kCreateMatrix, 1LL * rows_ * cols_, bytes, 0,
+                      bytes);
+  char* block = static_cast<char*>(::operator new[](bytes, kAlignment));
+  new (block) Header;
+  data_ = reinterpret_cast<double*>(block + kHeaderBytes);
+  matrix_ = reinterpret_cast<double**>(data_ + elements);
   for (int i = 0; i < rows_; ++i) {
-    matrix_[i] = new double[cols_]();
+    matrix_[i] = data_ + static_cast<size_t>(i) * stride_;
+  }
+
+  // Страницы получают узел NUMA при первой записи, то есть при обнулении
+  size_t data_bytes = elements * sizeof(double);
+  S21NumaPolicy policy = S21Numa::PolicyFor(data_bytes);
+  if (policy == S21NumaPolicy::kDefault) {
+    std::memset(data_, 0, data_bytes);
+    return;
+  }
+  S21Numa::RecordAllocation(policy, data_bytes);
+  if (policy == S21NumaPolicy::kFirstTouch) {
+    double* data = data_;
+    size_t stride = stride_;
+    S21ParallelFor(0, rows_, std::max(1, kParallelElements / cols_),
+                   [data, stride](int from, int to) {
+                     std::memset(data + from * stride, 0,
+                                 (to - from) * stride * sizeof(double));
+                   });
+  } else {
+    S21Numa::Bind(data_, data_bytes, policy);
+    std::memset(data_, 0, data_bytes);
   }
 }
 
 void S21Matrix::FreeMatrix() {
+  InvalidateCache();
+  // Блок освобождает последний из разделяющих его объектов
+  if (matrix_ != nullptr &&
+      RefCount(data_).fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    Header& header = GetHeader(data_);
+    if (header.deleter) header.deleter(header.foreign);
+    header.~Header();
+    ::operator delete[](reinterpret_cast<char*>(data_) - kHeaderBytes,
+                        kAlignment);
+  }
+  data_ = nullptr;
+  matrix_ = nullptr;
+  rows_ = 0;
+  cols_ = 0;
+  stride_ = 0;
+}
+
+void S21Matrix::ShareStorage(const S21Matrix& other) {
+  stride_ = other.stride_;
+  data_ = other.data_;
+  matrix_ = other.matrix_;
   if (matrix_ != nullptr) {
+    RefCount(data_).fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void S21Matrix::Detach() {
+  if (matrix_ == nullptr ||
+      RefCount(data_).load(std::memory_order_acquire) == 1) {
+    return;
+  }
+  // Значения не меняются, поэтому кэш разложения остаётся верным.
+  // Копия внешнего буфера становится обычным собственным блоком
+  S21Matrix copy(rows_, cols_);
+  if (IsExternal()) {
     for (int i = 0; i < rows_; ++i) {
-      delete[] matrix_[i];
+      std::memcpy(copy.matrix_[i], matrix_[i], cols_ * sizeof(double));
     }
-    delete[] matrix_;
-    matrix_ = nullptr;
+  } else {
+    std::memcpy(copy.data_, data_,
+                static_cast<size_t>(rows_) * stride_ * sizeof(double));
   }
-  rows_ = 0;
-  cols_ = 0;
+  std::swap(stride_, copy.stride_);
+  std::swap(data_, copy.data_);
+  std::swap(matrix_, copy.matrix_);
+}
+
+bool S21Matrix::IsExternal() const {
+  return matrix_ != nullptr && GetHeader(data_).foreign != nullptr;
 }
 
 S21Matrix::S21Matrix() : S21Matrix(3, 3) {}
 
 S21Matrix::S21Matrix(int rows, int cols)
-    : rows_(rows), cols_(cols), matrix_(nullptr) {
+    : rows_(rows),
+      cols_(cols),
+      stride_(0),
+      data_(nullptr),
+      matrix_(nullptr),
+      factorization_(nullptr),
+      cache_enabled_(true) {
   if (rows < 1 || cols < 1) {
     throw std::invalid_argument("Matrix dimensions must be non-negative");
   }
   CreateMatrix();
 }
 
-S21Matrix::S21Matrix(const S21Matrix& other)
-    : rows_(other.rows_), cols_(other.cols_), matrix_(nullptr) {
-  // Обработка на пустую матрицу
-  if (other.matrix_ != nullptr) {
-    CreateMatrix();
+S21Matrix::S21Matrix(double* data, int rows, int cols, int row_stride,
+                     int col_stride, Deleter deleter)
+    : rows_(rows),
+      cols_(cols),
+      stride_(0),
+      data_(nullptr),
+      matrix_(nullptr),
+      factorization_(nullptr),
+      cache_enabled_(true) {
+  S21_TELEMETRY_SCOPE(S21Op::kAdopt, 1LL * rows_ * cols_);
+  // Строки не лежат подряд или перекрываются: указатели на строки
+  // такой буфер не описывают, и элементы копируются в свой блок
+  bool copy = col_stride != 1 || (rows > 1 && row_stride < cols);
+  char* block = nullptr;
+  // Как у std::shared_ptr: если конструктор бросает исключение, буфер
+  // не остаётся без владельца и deleter уже вызван
+  try {
+    if (data == nullptr) {
+      throw std::invalid_argument("Buffer must not be null");
+    }
+    if (rows < 1 || cols < 1) {
+      throw std::invalid_argument("Matrix dimensions must be non-negative");
+    }
+    if ((rows > 1 && row_stride == 0) || (cols > 1 && col_stride == 0)) {
+      throw std::invalid_argument("Strides must be non-zero");
+    }
+    if (copy) {
+      CreateMatrix();
+    } else {
+      block = static_cast<char*>(::operator new[](
+          kHeaderBytes + rows_ * sizeof(double*), kAlignment));
+    }
+  } catch (...) {
+    if (deleter) deleter(data);
+    throw;
+  }
+
+  if (copy) {
     for (int i = 0; i < rows_; ++i) {
+      const double* row = data + static_cast<long long>(i) * row_stride;
       for (int j = 0; j < cols_; ++j) {
-        matrix_[i][j] = other.matrix_[i][j];
+        matrix_[i][j] = row[static_cast<long long>(j) * col_stride];
       }
     }
+    if (deleter) deleter(data);
+    return;
+  }
+  Header* header = new (block) Header;
+  header->foreign = data;
+  header->deleter = std::move(deleter);
+  stride_ = rows_ > 1 ? row_stride : cols_;
+  data_ = reinterpret_cast<double*>(block + kHeaderBytes);
+  matrix_ = reinterpret_cast<double**>(data_);
+  for (int i = 0; i < rows_; ++i) {
+    matrix_[i] = data + static_cast<size_t>(i) * stride_;
+  }
+}
+
+S21Matrix::S21Matrix(const S21Matrix& other)
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(0),
+      data_(nullptr),
+      matrix_(nullptr),
+      factorization_(nullptr),
+      cache_enabled_(other.cache_enabled_) {
+  S21_TELEMETRY_SCOPE(S21Op::kCopy, 1LL * rows_ * cols_);
+  // Обработка на пустую матрицу
+  if (other.matrix_ != nullptr) {
+    // Копия разделяет блок с оригиналом до первой записи (copy-on-write)
+    ShareStorage(other);
     /* В современной разработке используют std::copy
     for (int i = 0; i < rows_; ++i) {
       std::copy(other.matrix_[i], other.matrix_[i] + cols_, matrix_[i]);
@@ -53,11 +235,21 @@ S21Matrix::S21Matrix(const S21Matrix& other)
 }
 
 S21Matrix::S21Matrix(S21Matrix&& other) noexcept
-    : rows_(other.rows_), cols_(other.cols_), matrix_(other.matrix_) {
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(other.stride_),
+      data_(other.data_),
+      matrix_(other.matrix_),
+      factorization_(other.factorization_),
+      cache_enabled_(other.cache_enabled_) {
+  S21_TELEMETRY_SCOPE(S21Op::kMove, 1LL * rows_ * cols_);
   // спецификатор noexcept указывается для обеспечения эффективности
   other.rows_ = 0;
   other.cols_ = 0;
+  other.stride_ = 0;
+  other.data_ = nullptr;
   other.matrix_ = nullptr;
+  other.factorization_ = nullptr;
 
   /* Забираем ресурсы другого объекта (другая реализация)
   S21Matrix::S21Matrix(S21Matrix&& other) noexcept
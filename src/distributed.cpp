@@ -0,0 +1,404 @@
+#if defined(S21_MATRIX_MPI)
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "s21_distributed.h"
+
+namespace {
+
+// Сколько из первых n индексов достаётся процессу p из count при
+// циклической раздаче блоков (numroc в ScaLAPACK). Индексы процесса
+// идут в том же порядке, что и глобальные, поэтому LocalCount(g, ...)
+// — это и первый локальный индекс с глобальным номером не меньше g
+int LocalCount(int n, int block, int p, int count) {
+  int blocks = n / block;
+  int result = blocks / count * block;
+  int extra = blocks % count;
+  if (p < extra) {
+    result += block;
+  } else if (p == extra) {
+    result += n % block;
+  }
+  return result;
+}
+
+int ToGlobal(int local, int block, int p, int count) {
+  return (local / block * count + p) * block + local % block;
+}
+
+int Owner(int global, int block, int count) {
+  return global / block % count;
+}
+
+int ToLocal(int global, int block, int count) {
+  return global / block / count * block + global % block;
+}
+
+// Блоки строки из глобальной раскладки в локальную и обратно
+void ScatterRow(const double* full, double* local, int local_count,
+                int block, int p, int count) {
+  for (int start = 0; start < local_count; start += block) {
+    const double* g = full + ToGlobal(start, block, p, count);
+    std::copy(g, g + std::min(block, local_count - start), local + start);
+  }
+}
+
+void GatherRow(const double* local, double* full, int local_count, int block,
+               int p, int count) {
+  for (int start = 0; start < local_count; start += block) {
+    std::copy(local + start,
+              local + start + std::min(block, local_count - start),
+              full + ToGlobal(start, block, p, count));
+  }
+}
+
+// Прямоугольник [row, row + rows) x [col, col + cols) локальной матрицы
+// в сплошной буфер и обратно
+void Pack(const S21Matrix& m, int row, int rows, int col, int cols,
+          double* out) {
+  for (int i = 0; i < rows; ++i) {
+    const double* r = m.Row(row + i) + col;
+    std::copy(r, r + cols, out + static_cast<long long>(i) * cols);
+  }
+}
+
+S21Matrix Unpack(const double* in, int rows, int cols) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    const double* r = in + static_cast<long long>(i) * cols;
+    std::copy(r, r + cols, m.Row(i));
+  }
+  return m;
+}
+
+}  // namespace
+
+S21ProcessGrid::S21ProcessGrid(MPI_Comm comm) {
+  int size = 0;
+  MPI_Comm_size(comm, &size);
+  int dims[2] = {0, 0};
+  MPI_Dims_create(size, 2, dims);
+  Init(comm, dims[0], dims[1]);
+}
+
+S21ProcessGrid::S21ProcessGrid(MPI_Comm comm, int rows, int cols) {
+  Init(comm, rows, cols);
+}
+
+void S21ProcessGrid::Init(MPI_Comm comm, int rows, int cols) {
+  int size = 0;
+  MPI_Comm_size(comm, &size);
+  if (rows < 1 || cols < 1 || rows * cols != size) {
+    throw std::invalid_argument(
+        "Process grid dimensions must multiply to the communicator size");
+  }
+  rows_ = rows;
+  cols_ = cols;
+  // Собственная копия коммуникатора: наши сообщения не смешиваются
+  // с сообщениями вызывающего кода
+  MPI_Comm_dup(comm, &comm_);
+  MPI_Comm_rank(comm_, &rank_);
+  my_row_ = rank_ / cols_;
+  my_col_ = rank_ % cols_;
+  MPI_Comm_split(comm_, my_row_, my_col_, &row_comm_);
+  MPI_Comm_split(comm_, my_col_, my_row_, &col_comm_);
+}
+
+S21ProcessGrid::~S21ProcessGrid() {
+  MPI_Comm_free(&row_comm_);
+  MPI_Comm_free(&col_comm_);
+  MPI_Comm_free(&comm_);
+}
+
+S21DistributedMatrix::S21DistributedMatrix(const S21ProcessGrid& grid,
+                                           int rows, int cols, int block)
+    : grid_(&grid), rows_(rows), cols_(cols), block_(block), local_(1, 1) {
+  if (rows < 1 || cols < 1 || block < 1) {
+    throw std::invalid_argument("Matrix dimensions must be non-negative");
+  }
+  if ((rows + block - 1) / block < grid.GetRows() ||
+      (cols + block - 1) / block < grid.GetCols()) {
+    throw std::invalid_argument(
+        "Matrix has fewer blocks than the process grid");
+  }
+  local_ = S21Matrix(
+      LocalCount(rows, block, grid.MyRow(), grid.GetRows()),
+      LocalCount(cols, block, grid.MyCol(), grid.GetCols()));
+}
+
+int S21DistributedMatrix::GlobalRow(int local_row) const {
+  return ToGlobal(local_row, block_, grid_->MyRow(), grid_->GetRows());
+}
+
+int S21DistributedMatrix::GlobalCol(int local_col) const {
+  return ToGlobal(local_col, block_, grid_->MyCol(), grid_->GetCols());
+}
+
+S21DistributedMatrix S21DistributedMatrix::Scatter(const S21ProcessGrid& grid,
+                                                   const S21Matrix& m,
+                                                   int rows, int cols,
+                                                   int block, int root) {
+  S21DistributedMatrix result(grid, rows, cols, block);
+  // Размер проверяется на root, но бросают все, иначе остальные
+  // процессы повиснут в MPI_Scatterv
+  int ok = grid.Rank() != root || (m.GetRows() == rows && m.GetCols() == cols);
+  MPI_Bcast(&ok, 1, MPI_INT, root, grid.Comm());
+  if (!ok) {
+    throw std::logic_error("Matrix dimensions do not match the distribution");
+  }
+
+  int size = grid.Size(), p = grid.GetRows(), q = grid.GetCols();
+  std::vector<int> counts(size), displs(size);
+  std::vector<double> send;
+  if (grid.Rank() == root) {
+    long long total = 0;
+    for (int r = 0; r < size; ++r) {
+      counts[r] = LocalCount(rows, block, r / q, p) *
+                  LocalCount(cols, block, r % q, q);
+      displs[r] = static_cast<int>(total);
+      total += counts[r];
+    }
+    send.resize(total);
+    for (int r = 0; r < size; ++r) {
+      int lr = LocalCount(rows, block, r / q, p);
+      int lc = LocalCount(cols, block, r % q, q);
+      double* out = send.data() + displs[r];
+      for (int i = 0; i < lr; ++i) {
+        ScatterRow(m.Row(ToGlobal(i, block, r / q, p)),
+                   out + static_cast<long long>(i) * lc, lc, block, r % q, q);
+      }
+    }
+  }
+
+  S21Matrix& local = result.local_;
+  int lr = local.GetRows(), lc = local.GetCols();
+  std::vector<double> recv(static_cast<long long>(lr) * lc);
+  MPI_Scatterv(send.data(), counts.data(), displs.data(), MPI_DOUBLE,
+               recv.data(), lr * lc, MPI_DOUBLE, root, grid.Comm());
+  local = Unpack(recv.data(), lr, lc);
+  return result;
+}
+
+S21Matrix S21DistributedMatrix::Gather(int root) const {
+  const S21ProcessGrid& grid = *grid_;
+  int size = grid.Size(), p = grid.GetRows(), q = grid.GetCols();
+  int lr = local_.GetRows(), lc = local_.GetCols();
+  std::vector<double> send(static_cast<long long>(lr) * lc);
+  Pack(local_, 0, lr, 0, lc, send.data());
+
+  std::vector<int> counts(size), displs(size);
+  std::vector<double> recv;
+  if (grid.Rank() == root) {
+    long long total = 0;
+    for (int r = 0; r < size; ++r) {
+      counts[r] = LocalCount(rows_, block_, r / q, p) *
+                  LocalCount(cols_, block_, r % q, q);
+      displs[r] = static_cast<int>(total);
+      total += counts[r];
+    }
+    recv.resize(total);
+  }
+  MPI_Gatherv(send.data(), lr * lc, MPI_DOUBLE, recv.data(), counts.data(),
+              displs.data(), MPI_DOUBLE, root, grid.Comm());
+  if (grid.Rank() != root) return S21Matrix(1, 1);
+
+  S21Matrix result(rows_, cols_);
+  for (int r = 0; r < size; ++r) {
+    int rlr = LocalCount(rows_, block_, r / q, p);
+    int rlc = LocalCount(cols_, block_, r % q, q);
+    const double* in = recv.data() + displs[r];
+    for (int i = 0; i < rlr; ++i) {
+      GatherRow(in + static_cast<long long>(i) * rlc,
+                result.Row(ToGlobal(i, block_, r / q, p)), rlc, block_, r % q,
+                q);
+    }
+  }
+  return result;
+}
+
+S21DistributedMatrix S21DistributedMatrix::Multiply(
+    const S21DistributedMatrix& a, const S21DistributedMatrix& b) {
+  if (a.grid_ != b.grid_ || a.block_ != b.block_) {
+    throw std::logic_error("Matrices must share the grid and block size");
+  }
+  if (a.cols_ != b.rows_) {
+    throw std::logic_error("Cols must be equal rows other matrix");
+  }
+  const S21ProcessGrid& grid = *a.grid_;
+  int p = grid.GetRows(), q = grid.GetCols(), nb = a.block_;
+  S21DistributedMatrix c(grid, a.rows_, b.cols_, nb);
+  int lr = c.local_.GetRows(), lc = c.local_.GetCols();
+  int steps = (a.cols_ + nb - 1) / nb;
+
+  // Две пары буферов: пока шаг s умножается, панели шага s + 1 уже
+  // рассылаются неблокирующими MPI_Ibcast
+  std::vector<double> a_panel[2], b_panel[2];
+  MPI_Request requests[2][2];
+  auto post = [&](int s) {
+    int slot = s % 2, w = std::min(nb, a.cols_ - s * nb);
+    a_panel[slot].resize(static_cast<long long>(lr) * w);
+    b_panel[slot].resize(static_cast<long long>(w) * lc);
+    if (grid.MyCol() == s % q) {
+      Pack(a.local_, 0, lr, s / q * nb, w, a_panel[slot].data());
+    }
+    if (grid.MyRow() == s % p) {
+      Pack(b.local_, s / p * nb, w, 0, lc, b_panel[slot].data());
+    }
+    MPI_Ibcast(a_panel[slot].data(), lr * w, MPI_DOUBLE, s % q,
+               grid.RowComm(), &requests[slot][0]);
+    MPI_Ibcast(b_panel[slot].data(), w * lc, MPI_DOUBLE, s % p,
+               grid.ColComm(), &requests[slot][1]);
+  };
+
+  post(0);
+  for (int s = 0; s < steps; ++s) {
+    if (s + 1 < steps) post(s + 1);
+    int slot = s % 2, w = std::min(nb, a.cols_ - s * nb);
+    MPI_Waitall(2, requests[slot], MPI_STATUSES_IGNORE);
+    S21Matrix ap = Unpack(a_panel[slot].data(), lr, w);
+    S21Matrix bp = Unpack(b_panel[slot].data(), w, lc);
+    c.local_.Gemm(1.0, ap, bp, 1.0);
+  }
+  return c;
+}
+
+S21DistributedLU S21DistributedMatrix::LU() const {
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix must be square to factorize");
+  }
+  const S21ProcessGrid& grid = *grid_;
+  int n = rows_, nb = block_, p = grid.GetRows(), q = grid.GetCols();
+  int my_row = grid.MyRow(), my_col = grid.MyCol();
+  S21DistributedLU result{*this, std::vector<int>(n), 1.0, false};
+  S21Matrix& local = result.factors.local_;
+  int lr = local.GetRows(), lc = local.GetCols();
+  // Копия делит хранение с исходной матрицей: отделяем один раз
+  std::vector<double*> a(lr);
+  for (int i = 0; i < lr; ++i) a[i] = local.Row(i);
+
+  // Перестановка строк целиком, по всем столбцам решётки
+  auto swap_rows = [&](int r1, int r2) {
+    int o1 = Owner(r1, nb, p), o2 = Owner(r2, nb, p);
+    int l1 = ToLocal(r1, nb, p), l2 = ToLocal(r2, nb, p);
+    if (o1 == my_row && o2 == my_row) {
+      std::swap_ranges(a[l1], a[l1] + lc, a[l2]);
+    } else if (o1 == my_row) {
+      MPI_Sendrecv_replace(a[l1], lc, MPI_DOUBLE, o2, 0, o2, 0,
+                           grid.ColComm(), MPI_STATUS_IGNORE);
+    } else if (o2 == my_row) {
+      MPI_Sendrecv_replace(a[l2], lc, MPI_DOUBLE, o1, 0, o1, 0,
+                           grid.ColComm(), MPI_STATUS_IGNORE);
+    }
+  };
+
+  // Порог вырожденности тот же, что у последовательного разложения
+  double max_abs = local.MaxAbs();
+  MPI_Allreduce(MPI_IN_PLACE, &max_abs, 1, MPI_DOUBLE, MPI_MAX, grid.Comm());
+  double tolerance = n * std::numeric_limits<double>::epsilon() * max_abs;
+
+  double sign = 1.0;
+  std::vector<double> l_panel, u_panel, pivot_row(nb);
+  for (int kb = 0; kb * nb < n; ++kb) {
+    int j0 = kb * nb, w = std::min(nb, n - j0);
+    int pc = kb % q, pr = kb % p, panel_col = kb / q * nb;
+
+    // Панель раскладывается столбцами процессов столбца решётки pc;
+    // номер ведущей строки рассылается всем для перестановки
+    for (int j = j0; j < j0 + w; ++j) {
+      int lj = panel_col + (j - j0);
+      int below = LocalCount(j, nb, my_row, p);
+      struct {
+        double value;
+        int row;
+      } best{-1.0, j};
+      if (my_col == pc) {
+        for (int i = below; i < lr; ++i) {
+          double v = std::fabs(a[i][lj]);
+          if (v > best.value) best = {v, ToGlobal(i, nb, my_row, p)};
+        }
+        MPI_Allreduce(MPI_IN_PLACE, &best, 1, MPI_DOUBLE_INT, MPI_MAXLOC,
+                      grid.ColComm());
+      }
+      MPI_Bcast(&best, 1, MPI_DOUBLE_INT, pc, grid.RowComm());
+      result.pivots[j] = best.row;
+      if (best.value <= tolerance) result.singular = true;
+      if (best.row != j) {
+        swap_rows(j, best.row);
+        sign = -sign;
+      }
+
+      if (my_col != pc) continue;
+      int tail = w - (j - j0);
+      int owner = Owner(j, nb, p);
+      if (owner == my_row) {
+        double* row = a[ToLocal(j, nb, p)] + lj;
+        std::copy(row, row + tail, pivot_row.begin());
+      }
+      MPI_Bcast(pivot_row.data(), tail, MPI_DOUBLE, owner, grid.ColComm());
+      int start = LocalCount(j + 1, nb, my_row, p);
+      for (int i = start; i < lr; ++i) {
+        double* row = a[i] + lj;
+        if (pivot_row[0] != 0.0) row[0] /= pivot_row[0];
+        for (int t = 1; t < tail; ++t) row[t] -= row[0] * pivot_row[t];
+      }
+    }
+
+    // Столбцы L панели — всем процессам своей строки решётки
+    int panel_row = LocalCount(j0, nb, my_row, p);
+    int nr = lr - panel_row;
+    l_panel.resize(static_cast<long long>(nr) * w);
+    if (my_col == pc) Pack(local, panel_row, nr, panel_col, w, l_panel.data());
+    MPI_Bcast(l_panel.data(), nr * w, MPI_DOUBLE, pc, grid.RowComm());
+
+    // U12 = L11^{-1} A12 на строке решётки pr; L11 — первые w строк
+    // полученной панели
+    int trail_col = LocalCount(j0 + w, nb, my_col, q);
+    int nc = lc - trail_col;
+    u_panel.resize(static_cast<long long>(w) * nc);
+    if (my_row == pr && nc > 0) {
+      for (int r = 0; r < w; ++r) {
+        double* u = a[panel_row + r] + trail_col;
+        for (int t = 0; t < r; ++t) {
+          double l = l_panel[static_cast<long long>(r) * w + t];
+          const double* ut = a[panel_row + t] + trail_col;
+          for (int c = 0; c < nc; ++c) u[c] -= l * ut[c];
+        }
+      }
+      Pack(local, panel_row, w, trail_col, nc, u_panel.data());
+    }
+    MPI_Bcast(u_panel.data(), w * nc, MPI_DOUBLE, pr, grid.ColComm());
+
+    // A22 -= L21 * U12 локальным Gemm
+    int trail_row = LocalCount(j0 + w, nb, my_row, p);
+    int mr = lr - trail_row;
+    if (mr > 0 && nc > 0) {
+      S21Matrix l21 = Unpack(
+          l_panel.data() + static_cast<long long>(trail_row - panel_row) * w,
+          mr, w);
+      S21Matrix u12 = Unpack(u_panel.data(), w, nc);
+      S21Matrix update(mr, nc);
+      update.Gemm(1.0, l21, u12, 0.0);
+      for (int i = 0; i < mr; ++i) {
+        double* row = a[trail_row + i] + trail_col;
+        const double* d = update.Row(i);
+        for (int c = 0; c < nc; ++c) row[c] -= d[c];
+      }
+    }
+  }
+
+  // Определитель — произведение диагонали U по всем процессам
+  double product = 1.0;
+  for (int i = 0; i < n; ++i) {
+    if (Owner(i, nb, p) == my_row && Owner(i, nb, q) == my_col) {
+      product *= a[ToLocal(i, nb, p)][ToLocal(i, nb, q)];
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &product, 1, MPI_DOUBLE, MPI_PROD, grid.Comm());
+  result.determinant = result.singular ? 0.0 : sign * product;
+  return result;
+}
+
+#endif
@@ -0,0 +1,325 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+// Собственные значения и векторы симметричной матрицы n x n,
+// хранящейся по строкам в v: приведение к трёхдиагональному виду
+// отражениями Хаусхолдера (tred2) и неявный QL-алгоритм (tql2).
+// После вызова d — значения по убыванию, столбцы v — векторы
+void SymmetricEigen(int n, std::vector<double>& v, std::vector<double>& d) {
+  auto V = [&](int i, int j) -> double& { return v[i * n + j]; };
+  std::vector<double> e(n, 0.0);
+  d.assign(n, 0.0);
+  for (int j = 0; j < n; ++j) d[j] = V(n - 1, j);
+
+  for (int i = n - 1; i > 0; --i) {
+    double scale = 0.0, h = 0.0;
+    for (int k = 0; k < i; ++k) scale += std::fabs(d[k]);
+    if (scale == 0.0) {
+      e[i] = d[i - 1];
+      for (int j = 0; j < i; ++j) {
+        d[j] = V(i - 1, j);
+        V(i, j) = 0.0;
+        V(j, i) = 0.0;
+      }
+    } else {
+      for (int k = 0; k < i; ++k) {
+        d[k] /= scale;
+        h += d[k] * d[k];
+      }
+      double f = d[i - 1];
+      double g = f > 0 ? -std::sqrt(h) : std::sqrt(h);
+      e[i] = scale * g;
+      h -= f * g;
+      d[i - 1] = f - g;
+      for (int j = 0; j < i; ++j) e[j] = 0.0;
+      for (int j = 0; j < i; ++j) {
+        f = d[j];
+        V(j, i) = f;
+        g = e[j] + V(j, j) * f;
+        for (int k = j + 1; k <= i - 1; ++k) {
+          g += V(k, j) * d[k];
+          e[k] += V(k, j) * f;
+        }
+        e[j] = g;
+      }
+      f = 0.0;
+      for (int j = 0; j < i; ++j) {
+        e[j] /= h;
+        f += e[j] * d[j];
+      }
+      double hh = f / (h + h);
+      for (int j = 0; j < i; ++j) e[j] -= hh * d[j];
+      for (int j = 0; j < i; ++j) {
+        f = d[j];
+        g = e[j];
+        for (int k = j; k <= i - 1; ++k) V(k, j) -= (f * e[k] + g * d[k]);
+        d[j] = V(i - 1, j);
+        V(i, j) = 0.0;
+      }
+    }
+    d[i] = h;
+  }
+
+  for (int i = 0; i < n - 1; ++i) {
+    V(n - 1, i) = V(i, i);
+    V(i, i) = 1.0;
+    double h = d[i + 1];
+    if (h != 0.0) {
+      for (int k = 0; k <= i; ++k) d[k] = V(k, i + 1) / h;
+      for (int j = 0; j <= i; ++j) {
+        double g = 0.0;
+        for (int k = 0; k <= i; ++k) g += V(k, i + 1) * V(k, j);
+        for (int k = 0; k <= i; ++k) V(k, j) -= g * d[k];
+      }
+    }
+    for (int k = 0; k <= i; ++k) V(k, i + 1) = 0.0;
+  }
+  for (int j = 0; j < n; ++j) {
+    d[j] = V(n - 1, j);
+    V(n - 1, j) = 0.0;
+  }
+  V(n - 1, n - 1) = 1.0;
+
+  for (int i = 1; i < n; ++i) e[i - 1] = e[i];
+  e[n - 1] = 0.0;
+  double f = 0.0, tst1 = 0.0;
+  const double eps = std::numeric_limits<double>::epsilon();
+  for (int l = 0; l < n; ++l) {
+    tst1 = std::max(tst1, std::fabs(d[l]) + std::fabs(e[l]));
+    int m = l;
+    while (m < n - 1 && std::fabs(e[m]) > eps * tst1) ++m;
+    if (m > l) {
+      do {
+        double g = d[l];
+        double p = (d[l + 1] - g) / (2.0 * e[l]);
+        double r = std::hypot(p, 1.0);
+        if (p < 0) r = -r;
+        d[l] = e[l] / (p + r);
+        d[l + 1] = e[l] * (p + r);
+        double dl1 = d[l + 1];
+        double h = g - d[l];
+        for (int i = l + 2; i < n; ++i) d[i] -= h;
+        f += h;
+        p = d[m];
+        double c = 1.0, c2 = c, c3 = c, s = 0.0, s2 = 0.0;
+        double el1 = e[l + 1];
+        for (int i = m - 1; i >= l; --i) {
+          c3 = c2;
+          c2 = c;
+          s2 = s;
+          g = c * e[i];
+          h = c * p;
+          r = std::hypot(p, e[i]);
+          e[i + 1] = s * r;
+          s = e[i] / r;
+          c = p / r;
+          p = c * d[i] - s * g;
+          d[i + 1] = h + s * (c * g + s * d[i]);
+          for (int k = 0; k < n; ++k) {
+            h = V(k, i + 1);
+            V(k, i + 1) = s * V(k, i) + c * h;
+            V(k, i) = c * V(k, i) - s * h;
+          }
+        }
+        p = -s * s2 * c3 * el1 * e[l] / dl1;
+        e[l] = s * p;
+        d[l] = c * p;
+      } while (std::fabs(e[l]) > eps * tst1);
+    }
+    d[l] += f;
+    e[l] = 0.0;
+  }
+
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](int a, int b) { return d[a] > d[b]; });
+  std::vector<double> sorted_d(n), sorted_v(v.size());
+  for (int j = 0; j < n; ++j) {
+    sorted_d[j] = d[order[j]];
+    for (int i = 0; i < n; ++i) sorted_v[i * n + j] = V(i, order[j]);
+  }
+  d.swap(sorted_d);
+  v.swap(sorted_v);
+}
+
+double DotVec(const S21Vector& a, const S21Vector& b) {
+  const double* x = a.Data();
+  const double* y = b.Data();
+  double sum = 0.0;
+  for (int i = 0; i < a.GetSize(); ++i) sum += x[i] * y[i];
+  return sum;
+}
+
+// y += alpha * x
+void AxpyVec(double alpha, const S21Vector& x, S21Vector& y) {
+  const double* xs = x.Data();
+  double* ys = y.Data();
+  for (int i = 0; i < x.GetSize(); ++i) ys[i] += alpha * xs[i];
+}
+
+// Ортогонализация r к базису (дважды, для устойчивости); возвращает норму
+double Orthogonalize(const std::vector<S21Vector>& basis, S21Vector& r) {
+  for (int pass = 0; pass < 2; ++pass) {
+    for (const S21Vector& v : basis) AxpyVec(-DotVec(v, r), v, r);
+  }
+  return std::sqrt(DotVec(r, r));
+}
+
+}  // namespace
+
+S21EigenResult S21Matrix::EigenSymmetric() const {
+  S21_TELEMETRY_SCOPE(S21Op::kEigen, 1LL * rows_ * cols_);
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix must be square for eigenvalues");
+  }
+  // Допуск от масштаба матрицы: почти нулевые пары не сравниваются
+  // относительно самих себя
+  double tolerance = 1e-9 * MaxAbs();
+  if (!Compare(Transpose(), tolerance, S21Tolerance::kAbsolute, true).equal) {
+    throw std::logic_error("The matrix must be symmetric");
+  }
+
+  int n = rows_;
+  std::vector<double> v(static_cast<size_t>(n) * n), d;
+  for (int i = 0; i < n; ++i) {
+    std::copy(matrix_[i], matrix_[i] + n, v.begin() + i * n);
+  }
+  SymmetricEigen(n, v, d);
+
+  S21EigenResult result{S21Vector(n), S21Matrix(n, n), 0, true};
+  for (int j = 0; j < n; ++j) result.values(j) = d[j];
+  for (int i = 0; i < n; ++i) {
+    std::copy(v.begin() + i * n, v.begin() + (i + 1) * n,
+              result.vectors.matrix_[i]);
+  }
+  return result;
+}
+
+S21EigenResult S21Matrix::TopEigen(int k,
+                                   const S21LanczosOptions& options) const {
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix must be square for eigenvalues");
+  }
+  return TopEigen(
+      rows_, k,
+      [this](const S21Vector& x, S21Vector& y) { Gemv(1.0, x, 0.0, y); },
+      options);
+}
+
+S21EigenResult S21Matrix::TopEigen(int n, int k, const S21LinearOperator& op,
+                                   const S21LanczosOptions& options) {
+  S21_TELEMETRY_SCOPE(S21Op::kEigen, 1LL * n * k);
+  if (n < 1 || k < 1 || k > n) {
+    throw std::invalid_argument("Eigenpair count must be in [1, n]");
+  }
+  // Размер подпространства: не меньше 2k, чтобы было что отбрасывать
+  int m = options.max_subspace > 0 ? options.max_subspace
+                                   : std::max(2 * k + 1, k + 20);
+  m = std::min(std::max(m, k + 1), n);
+
+  std::mt19937_64 rng(options.seed);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  auto random_vector = [&]() {
+    S21Vector r(n);
+    for (int i = 0; i < n; ++i) r(i) = uniform(rng);
+    return r;
+  };
+
+  // Базис V, произведения AV и проекция H = V^T A V
+  std::vector<S21Vector> basis, images;
+  std::vector<double> h;  // m x m по строкам
+  std::vector<double> h_next(static_cast<size_t>(m) * m);
+  S21Vector direction = random_vector();
+  S21EigenResult result{S21Vector(k), S21Matrix(n, k), 0, false};
+
+  for (int restart = 0;; ++restart) {
+    result.iterations = restart;
+    int kept = static_cast<int>(basis.size());
+    h.assign(static_cast<size_t>(m) * m, 0.0);
+    for (int i = 0; i < kept; ++i) h[i * m + i] = h_next[i * m + i];
+
+    // Расширение до m векторов: направлением служит A v последнего вектора
+    while (static_cast<int>(basis.size()) < m) {
+      double norm = Orthogonalize(basis, direction);
+      if (norm < 1e-12) {
+        direction = random_vector();
+        norm = Orthogonalize(basis, direction);
+        if (norm < 1e-12) break;
+      }
+      for (int i = 0; i < n; ++i) direction(i) /= norm;
+      S21Vector image(n);
+      op(direction, image);
+      int p = static_cast<int>(basis.size());
+      basis.push_back(direction);
+      for (int i = 0; i <= p; ++i) {
+        double value = DotVec(basis[i], image);
+        h[i * m + p] = value;
+        h[p * m + i] = value;
+      }
+      images.push_back(image);
+      direction = std::move(image);
+    }
+
+    // Рэлей — Ритц на текущем подпространстве
+    int p = static_cast<int>(basis.size());
+    std::vector<double> s(static_cast<size_t>(p) * p), theta;
+    for (int i = 0; i < p; ++i) {
+      std::copy(h.begin() + i * m, h.begin() + i * m + p, s.begin() + i * p);
+    }
+    SymmetricEigen(p, s, theta);
+
+    int keep = std::min(p - 1, k + (p - k) / 2);
+    if (p == n || p <= k) keep = std::min(p, k);
+    std::vector<S21Vector> ritz, ritz_images;
+    // theta убывают, так что наибольшее по модулю — на одном из концов
+    double scale = std::max(
+        {std::fabs(theta[0]), std::fabs(theta[p - 1]), 1e-300});
+    bool converged = true;
+    S21Vector residual(n);
+    for (int j = 0; j < std::max(keep, std::min(k, p)); ++j) {
+      S21Vector y(n), ay(n);
+      for (int i = 0; i < p; ++i) {
+        AxpyVec(s[i * p + j], basis[i], y);
+        AxpyVec(s[i * p + j], images[i], ay);
+      }
+      S21Vector r(ay);
+      AxpyVec(-theta[j], y, r);
+      double r_norm = std::sqrt(DotVec(r, r));
+      if (j < k && r_norm > options.tolerance * scale) {
+        if (converged) residual = r;
+        converged = false;
+      }
+      ritz.push_back(std::move(y));
+      ritz_images.push_back(std::move(ay));
+    }
+
+    bool exhausted = restart + 1 >= options.max_restarts || p == n;
+    if (converged || exhausted || p < m) {
+      result.converged = converged || p == n;
+      for (int j = 0; j < k && j < p; ++j) {
+        result.values(j) = theta[j];
+        for (int i = 0; i < n; ++i) result.vectors.matrix_[i][j] = ritz[j](i);
+      }
+      return result;
+    }
+
+    // Толстый перезапуск: остаются keep векторов Ритца, а следующее
+    // направление — невязка первой несошедшейся пары
+    basis.assign(std::make_move_iterator(ritz.begin()),
+                 std::make_move_iterator(ritz.begin() + keep));
+    images.assign(std::make_move_iterator(ritz_images.begin()),
+                  std::make_move_iterator(ritz_images.begin() + keep));
+    for (int i = 0; i < keep; ++i) h_next[i * m + i] = theta[i];
+    direction = residual;
+  }
+}
@@ -0,0 +1,378 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+using Int128 = __int128;
+using UInt128 = unsigned __int128;
+
+// Модули меньше 2^28: произведение двух остатков меньше 2^56, и в
+// uint64 без приведения складываются kDelay таких произведений
+constexpr std::uint64_t kPrimeLimit = 1ULL << 28;
+constexpr int kPrimeBits = 27;
+constexpr int kDelay = 255;
+
+template <class T>
+std::string ToDecimal(T value) {
+  if (value == 0) return "0";
+  bool negative = value < 0;
+  UInt128 magnitude =
+      negative ? UInt128(0) - static_cast<UInt128>(value) : value;
+  std::string digits;
+  for (; magnitude > 0; magnitude /= 10) {
+    digits.push_back(static_cast<char>('0' + magnitude % 10));
+  }
+  if (negative) digits.push_back('-');
+  return std::string(digits.rbegin(), digits.rend());
+}
+
+// Неотрицательное длинное число по основанию 2^32, младшие разряды первые
+class BigUnsigned {
+ public:
+  explicit BigUnsigned(std::uint32_t value) : limbs_{value} { Trim(); }
+
+  void MulAdd(std::uint32_t factor, std::uint32_t addend) {
+    std::uint64_t carry = addend;
+    for (std::uint32_t& limb : limbs_) {
+      carry += static_cast<std::uint64_t>(limb) * factor;
+      limb = static_cast<std::uint32_t>(carry);
+      carry >>= 32;
+    }
+    if (carry != 0) limbs_.push_back(static_cast<std::uint32_t>(carry));
+    Trim();
+  }
+
+  int Compare(const BigUnsigned& other) const {
+    if (limbs_.size() != other.limbs_.size()) {
+      return limbs_.size() < other.limbs_.size() ? -1 : 1;
+    }
+    for (size_t i = limbs_.size(); i-- > 0;) {
+      if (limbs_[i] != other.limbs_[i]) {
+        return limbs_[i] < other.limbs_[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  // *this = other - *this при other >= *this
+  void SubtractFrom(const BigUnsigned& other) {
+    std::vector<std::uint32_t> result(other.limbs_);
+    std::int64_t borrow = 0;
+    for (size_t i = 0; i < result.size(); ++i) {
+      std::int64_t diff = static_cast<std::int64_t>(result[i]) - borrow -
+                          (i < limbs_.size() ? limbs_[i] : 0);
+      borrow = diff < 0;
+      result[i] = static_cast<std::uint32_t>(diff + (borrow << 32));
+    }
+    limbs_.swap(result);
+    Trim();
+  }
+
+  std::string ToDecimal(bool negative = false) const {
+    std::vector<std::uint32_t> rest(limbs_);
+    std::vector<std::uint32_t> chunks;  // по 9 цифр, младшие первые
+    while (!rest.empty()) {
+      std::uint64_t remainder = 0;
+      for (size_t i = rest.size(); i-- > 0;) {
+        std::uint64_t current = (remainder << 32) | rest[i];
+        rest[i] = static_cast<std::uint32_t>(current / 1000000000);
+        remainder = current % 1000000000;
+      }
+      chunks.push_back(static_cast<std::uint32_t>(remainder));
+      while (!rest.empty() && rest.back() == 0) rest.pop_back();
+    }
+    if (chunks.empty()) return "0";
+    std::string result = negative ? "-" : "";
+    result += std::to_string(chunks.back());
+    for (size_t i = chunks.size() - 1; i-- > 0;) {
+      std::string chunk = std::to_string(chunks[i]);
+      result += std::string(9 - chunk.size(), '0') + chunk;
+    }
+    return result;
+  }
+
+ private:
+  void Trim() {
+    while (!limbs_.empty() && limbs_.back() == 0) limbs_.pop_back();
+  }
+
+  std::vector<std::uint32_t> limbs_;
+};
+
+std::uint64_t PowMod(std::uint64_t base, std::uint64_t exponent,
+                     std::uint64_t p) {
+  std::uint64_t result = 1;
+  for (base %= p; exponent > 0; exponent >>= 1) {
+    if (exponent & 1) result = result * base % p;
+    base = base * base % p;
+  }
+  return result;
+}
+
+// Детерминированный Миллер-Рабин для чисел меньше 3.2 * 10^9
+bool IsPrime(std::uint64_t n) {
+  if (n < 2 || n % 2 == 0) return n == 2;
+  std::uint64_t d = n - 1;
+  int s = 0;
+  for (; d % 2 == 0; d /= 2) ++s;
+  for (std::uint64_t a : {2, 3, 5, 7}) {
+    if (a % n == 0) continue;
+    std::uint64_t x = PowMod(a, d, n);
+    bool composite = x != 1 && x != n - 1;
+    for (int r = 1; composite && r < s; ++r) {
+      x = x * x % n;
+      composite = x != n - 1;
+    }
+    if (composite) return false;
+  }
+  return true;
+}
+
+// count простых чисел, ближайших к kPrimeLimit снизу
+std::vector<std::uint64_t> Primes(int count) {
+  std::vector<std::uint64_t> primes;
+  for (std::uint64_t n = kPrimeLimit - 1;
+       static_cast<int>(primes.size()) < count; n -= 2) {
+    if (IsPrime(n)) primes.push_back(n);
+  }
+  return primes;
+}
+
+// Элементы по строкам; дробные, бесконечные и выходящие за int64 —
+// ошибка
+std::vector<std::int64_t> IntegerEntries(const S21Matrix& m) {
+  const double limit = 9223372036854775808.0;  // 2^63
+  std::vector<std::int64_t> entries;
+  entries.reserve(static_cast<size_t>(m.GetRows()) * m.GetCols());
+  for (int i = 0; i < m.GetRows(); ++i) {
+    const double* row = m.Row(i);
+    for (int j = 0; j < m.GetCols(); ++j) {
+      double x = row[j];
+      if (!(std::fabs(x) < limit) || std::trunc(x) != x) {
+        throw std::invalid_argument("Matrix elements must be integers");
+      }
+      entries.push_back(static_cast<std::int64_t>(x));
+    }
+  }
+  return entries;
+}
+
+// Дробное исключение Bareiss: после шага с ведущим элементом pivot
+// a[i][j] = (a[i][j] pivot - a[i][c] a[r][j]) / prev делится нацело,
+// а последний ведущий элемент квадратной матрицы равен ± определителю.
+// false при переполнении T
+template <class T>
+bool Bareiss(std::vector<T> a, int rows, int cols, T* det, int* rank) {
+  T prev = 1;
+  bool negate = false;
+  int r = 0;
+  for (int c = 0; c < cols && r < rows; ++c) {
+    int p = r;
+    while (p < rows && a[p * cols + c] == 0) ++p;
+    if (p == rows) continue;
+    if (p != r) {
+      std::swap_ranges(a.begin() + r * cols, a.begin() + (r + 1) * cols,
+                       a.begin() + p * cols);
+      negate = !negate;
+    }
+    const T* pivot_row = a.data() + r * cols;
+    T pivot = pivot_row[c];
+    for (int i = r + 1; i < rows; ++i) {
+      T* row = a.data() + i * cols;
+      T head = row[c];
+      for (int j = c + 1; j < cols; ++j) {
+        T x, y;
+        if (__builtin_mul_overflow(row[j], pivot, &x) ||
+            __builtin_mul_overflow(head, pivot_row[j], &y) ||
+            __builtin_sub_overflow(x, y, &x) ||
+            (prev == -1 && x == std::numeric_limits<T>::min())) {
+          return false;
+        }
+        row[j] = x / prev;
+      }
+      row[c] = 0;
+    }
+    prev = pivot;
+    ++r;
+  }
+  *rank = r;
+  if (rows == cols) {
+    if (r < rows) {
+      *det = 0;
+    } else if (!negate) {
+      *det = prev;
+    } else if (prev == std::numeric_limits<T>::min()) {
+      return false;
+    } else {
+      *det = -prev;
+    }
+  }
+  return true;
+}
+
+// Гаусс по модулю p с отложенным приведением: строки, ещё не ставшие
+// ведущими, копят до kDelay слагаемых. Возвращает ранг и определитель
+// по модулю p (0 для неквадратной или вырожденной)
+int EliminateModulo(const std::vector<std::int64_t>& entries, int rows,
+                    int cols, std::uint64_t p, std::uint64_t* det) {
+  std::vector<std::uint64_t> a(entries.size());
+  for (size_t k = 0; k < entries.size(); ++k) {
+    std::int64_t residue = entries[k] % static_cast<std::int64_t>(p);
+    a[k] = static_cast<std::uint64_t>(residue < 0 ? residue + p : residue);
+  }
+  std::uint64_t d = 1;
+  int r = 0, pending = 0;
+  for (int c = 0; c < cols && r < rows; ++c) {
+    int pivot = -1;
+    for (int i = r; i < rows; ++i) {
+      std::uint64_t& x = a[i * cols + c];
+      x %= p;
+      if (x != 0 && pivot < 0) pivot = i;
+    }
+    if (pivot < 0) continue;
+    if (pending == kDelay) {
+      for (int i = r; i < rows; ++i) {
+        for (int j = c + 1; j < cols; ++j) a[i * cols + j] %= p;
+      }
+      pending = 0;
+    }
+    std::uint64_t* pivot_row = a.data() + r * cols;
+    if (pivot != r) {
+      std::swap_ranges(pivot_row, pivot_row + cols, a.data() + pivot * cols);
+      d = p - d;
+    }
+    for (int j = c + 1; j < cols; ++j) pivot_row[j] %= p;
+    d = d * pivot_row[c] % p;
+    std::uint64_t inverse = PowMod(pivot_row[c], p - 2, p);
+    for (int i = r + 1; i < rows; ++i) {
+      std::uint64_t* row = a.data() + i * cols;
+      std::uint64_t l = row[c] * inverse % p;
+      row[c] = 0;
+      if (l == 0) continue;
+      std::uint64_t g = p - l;
+      for (int j = c + 1; j < cols; ++j) row[j] += g * pivot_row[j];
+    }
+    ++pending;
+    ++r;
+  }
+  *det = rows == cols && r == rows ? d : 0;
+  return r;
+}
+
+// Число простых, произведение которых больше удвоенной оценки Адамара
+// |det| <= prod ||a_i||; для ранга строки нормы меньше 1 не учитываются
+int PrimeCount(const std::vector<std::int64_t>& entries, int rows,
+               int cols) {
+  long double bits = 2.0L;
+  for (int i = 0; i < rows; ++i) {
+    long double norm = 0.0L;
+    for (int j = 0; j < cols; ++j) {
+      long double x = static_cast<long double>(entries[i * cols + j]);
+      norm += x * x;
+    }
+    if (norm > 1.0L) bits += 0.5L * std::log2(norm);
+  }
+  return static_cast<int>(bits / kPrimeBits) + 1;
+}
+
+std::string MultimodularDeterminant(const std::vector<std::int64_t>& entries,
+                                    int n) {
+  std::vector<std::uint64_t> primes = Primes(PrimeCount(entries, n, n));
+  int count = static_cast<int>(primes.size());
+  std::vector<std::uint64_t> residues(count);
+  S21ParallelFor(0, count, 1, [&](int from, int to) {
+    for (int k = from; k < to; ++k) {
+      EliminateModulo(entries, n, n, primes[k], &residues[k]);
+    }
+  });
+
+  // Гарнер: det = c0 + c1 p0 + c2 p0 p1 + ..., 0 <= c_k < p_k
+  std::vector<std::uint64_t> digits(count);
+  for (int k = 0; k < count; ++k) {
+    std::uint64_t p = primes[k], v = residues[k];
+    for (int j = 0; j < k; ++j) {
+      v = (v + p - digits[j] % p) % p * PowMod(primes[j], p - 2, p) % p;
+    }
+    digits[k] = v;
+  }
+  BigUnsigned value(static_cast<std::uint32_t>(digits[count - 1]));
+  BigUnsigned modulus(1);
+  for (int k = count - 2; k >= 0; --k) {
+    value.MulAdd(static_cast<std::uint32_t>(primes[k]),
+                 static_cast<std::uint32_t>(digits[k]));
+  }
+  for (std::uint64_t p : primes) {
+    modulus.MulAdd(static_cast<std::uint32_t>(p), 0);
+  }
+  // Симметричный остаток: значения больше половины модуля отрицательны
+  BigUnsigned twice(value);
+  twice.MulAdd(2, 0);
+  if (twice.Compare(modulus) <= 0) return value.ToDecimal();
+  value.SubtractFrom(modulus);
+  return value.ToDecimal(true);
+}
+
+// Ранг по модулю p не больше ранга над Q; для минора ранга r он
+// совпадает хотя бы по одному из модулей, произведение которых больше
+// оценки Адамара минора
+int MultimodularRank(const std::vector<std::int64_t>& entries, int rows,
+                     int cols) {
+  int full = std::min(rows, cols);
+  std::vector<std::uint64_t> primes =
+      Primes(PrimeCount(entries, rows, cols));
+  std::uint64_t det;
+  int rank = EliminateModulo(entries, rows, cols, primes[0], &det);
+  if (rank == full) return rank;
+  int count = static_cast<int>(primes.size());
+  std::vector<int> ranks(count, rank);
+  S21ParallelFor(1, count, 1, [&](int from, int to) {
+    std::uint64_t residue;
+    for (int k = from; k < to; ++k) {
+      ranks[k] = EliminateModulo(entries, rows, cols, primes[k], &residue);
+    }
+  });
+  return *std::max_element(ranks.begin(), ranks.end());
+}
+
+}  // namespace
+
+std::string S21Matrix::ExactDeterminant() const {
+  S21_TELEMETRY_SCOPE(S21Op::kExactDeterminant, 1LL * rows_ * cols_);
+  if (rows_ != cols_) {
+    throw std::logic_error(
+        "The matrix must be square to calculate the determinant");
+  }
+  std::vector<std::int64_t> entries = IntegerEntries(*this);
+  int rank;
+  std::int64_t det64;
+  if (Bareiss(entries, rows_, cols_, &det64, &rank)) return ToDecimal(det64);
+  Int128 det128;
+  if (Bareiss(std::vector<Int128>(entries.begin(), entries.end()), rows_,
+              cols_, &det128, &rank)) {
+    return ToDecimal(det128);
+  }
+  return MultimodularDeterminant(entries, rows_);
+}
+
+int S21Matrix::ExactRank() const {
+  S21_TELEMETRY_SCOPE(S21Op::kExactRank, 1LL * rows_ * cols_);
+  std::vector<std::int64_t> entries = IntegerEntries(*this);
+  int rank;
+  std::int64_t det64;
+  if (Bareiss(entries, rows_, cols_, &det64, &rank)) return rank;
+  Int128 det128;
+  if (Bareiss(std::vector<Int128>(entries.begin(), entries.end()), rows_,
+              cols_, &det128, &rank)) {
+    return rank;
+  }
+  return MultimodularRank(entries, rows_, cols_);
+}
@@ -0,0 +1,70 @@
+#include "s21_executor.h"
+#include "s21_numa.h"
+#include "s21_parallel.h"
+
+namespace {
+
+thread_local int t_worker_index = -1;
+
+}  // namespace
+
+S21Executor& S21Executor::Instance() {
+  static S21Executor executor(S21ThreadCount());
+  return executor;
+}
+
+S21Executor::S21Executor(int workers) : own_queues_(workers), stop_(false) {
+  for (int i = 0; i < workers; ++i) {
+    workers_.emplace_back(&S21Executor::WorkerLoop, this, i);
+  }
+}
+
+S21Executor::~S21Executor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+}
+
+void S21Executor::Submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push_back(std::move(task));
+  }
+  cv_.notify_one();
+}
+
+void S21Executor::SubmitTo(int worker, std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    own_queues_[worker].push_back(std::move(task));
+  }
+  // Общая переменная условия: будим всех, чтобы проснулся адресат
+  cv_.notify_all();
+}
+
+bool S21Executor::InWorker() { return t_worker_index >= 0; }
+
+int S21Executor::WorkerIndex() { return t_worker_index; }
+
+void S21Executor::WorkerLoop(int index) {
+  t_worker_index = index;
+  if (S21Numa::IsPinned()) S21Numa::PinCurrentWorker(index);
+  std::deque<std::function<void()>>& own = own_queues_[index];
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&] {
+        return stop_ || !own.empty() || !queue_.empty();
+      });
+      std::deque<std::function<void()>>& from = own.empty() ? queue_ : own;
+      if (from.empty()) return;
+      task = std::move(from.front());
+      from.pop_front();
+    }
+    task();
+  }
+}
@@ -0,0 +1,385 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
+#include "s21_tiled.h"
+
+struct S21Matrix::Factorization {
+  // LU-разложение PA = LU, L с единичной диагональю хранится под диагональю
+  std::unique_ptr<S21Matrix> lu;
+  std::vector<int> pivots;
+  double det = 0.0;
+  bool singular = false;
+  int rank = -1;  // -1: ранг ещё не вычислен
+  std::unique_ptr<S21Matrix> inverse;
+  // Поправка Вудбери поверх lu: x -= W (T (V^T x)), T = M^{-1} C
+  struct Correction {
+    S21Matrix w, t, v;
+  };
+  // Поправки малого ранга, внесённые в lu, inverse и det после разложения
+  std::vector<Correction> corrections;
+  int updates = 0;
+
+  void Factorize(const S21Matrix& m);
+  void SolveInPlace(double* x) const;
+};
+
+namespace {
+
+// Минимальное число элементов на поток при решении по столбцам
+constexpr long long kParallelElements = 1 << 15;
+
+// Столбцы правой части на поток: каждый стоит O(n^2)
+int ColumnGrain(int n) {
+  return static_cast<int>(
+      std::max(1LL, kParallelElements / (1LL * n * n)));
+}
+
+// Поправки подряд, после которых кэш считается заново: погрешность
+// формулы Вудбери накапливается с каждой
+constexpr int kMaxUpdates = 32;
+// Предельное усиление погрешности малой системой I + C V^T A^{-1} U
+constexpr double kMaxGrowth = 1e8;
+
+// Порог, ниже которого ведущий элемент Rank считается нулевым
+double PivotTolerance(const S21Matrix& a) {
+  return std::max(a.GetRows(), a.GetCols()) *
+         std::numeric_limits<double>::epsilon() * a.MaxAbs();
+}
+
+}  // namespace
+
+void S21Matrix::Factorization::Factorize(const S21Matrix& m) {
+  int n = m.rows_;
+  lu = std::make_unique<S21Matrix>(m);
+  lu->Detach();
+  pivots.assign(n, 0);
+  corrections.clear();
+  double** a = lu->matrix_;
+  singular = false;
+
+  // Вырожденной матрица считается только при точном нуле на диагонали:
+  // относительный порог объявил бы вырожденными плохо масштабированные
+  // матрицы вроде diag(1e-12, 1e4, 1). Порог нужен лишь Rank
+  if (n >= S21Tiled::kMinSize) {
+    singular = !S21Tiled::LU(a, n, pivots.data(), 0.0);
+  } else {
+    for (int k = 0; k < n; ++k) {
+      int p = k;
+      for (int i = k + 1; i < n; ++i) {
+        if (std::fabs(a[i][k]) > std::fabs(a[p][k])) p = i;
+      }
+      pivots[k] = p;
+      if (p != k) std::swap_ranges(a[k], a[k] + n, a[p]);
+      if (a[k][k] == 0.0) {
+        singular = true;
+        continue;
+      }
+      for (int i = k + 1; i < n; ++i) {
+        double l = a[i][k] / a[k][k];
+        a[i][k] = l;
+        if (l == 0.0) continue;
+        for (int j = k + 1; j < n; ++j) a[i][j] -= l * a[k][j];
+      }
+    }
+  }
+
+  det = 0.0;
+  if (!singular) {
+    det = 1.0;
+    for (int k = 0; k < n; ++k) det *= pivots[k] != k ? -a[k][k] : a[k][k];
+  }
+}
+
+void S21Matrix::Factorization::SolveInPlace(double* x) const {
+  int n = lu->rows_;
+  double** a = lu->matrix_;
+  for (int k = 0; k < n; ++k) {
+    if (pivots[k] != k) std::swap(x[k], x[pivots[k]]);
+  }
+  for (int i = 1; i < n; ++i) {
+    double sum = x[i];
+    for (int j = 0; j < i; ++j) sum -= a[i][j] * x[j];
+    x[i] = sum;
+  }
+  for (int i = n - 1; i >= 0; --i) {
+    double sum = x[i];
+    for (int j = i + 1; j < n; ++j) sum -= a[i][j] * x[j];
+    x[i] = sum / a[i][i];
+  }
+  for (const Correction& c : corrections) {
+    int k = c.t.rows_;
+    std::vector<double> y(k, 0.0), z(k, 0.0);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < k; ++j) y[j] += c.v.matrix_[i][j] * x[i];
+    }
+    for (int i = 0; i < k; ++i) {
+      for (int j = 0; j < k; ++j) z[i] += c.t.matrix_[i][j] * y[j];
+    }
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < k; ++j) x[i] -= c.w.matrix_[i][j] * z[j];
+    }
+  }
+}
+
+void S21Matrix::InvalidateCache() const {
+  delete factorization_;
+  factorization_ = nullptr;
+}
+
+void S21Matrix::SetCacheEnabled(bool enabled) {
+  cache_enabled_ = enabled;
+  if (!enabled) InvalidateCache();
+}
+
+S21Matrix::Factorization& S21Matrix::GetFactorization() const {
+  if (factorization_ == nullptr) factorization_ = new Factorization();
+  if (!factorization_->lu && rows_ == cols_) factorization_->Factorize(*this);
+  return *factorization_;
+}
+
+double S21Matrix::Determinant() const {
+  S21_TELEMETRY_SCOPE(S21Op::kDeterminant, 1LL * rows_ * cols_);
+  if (rows_ != cols_) {
+    throw std::logic_error(
+        "The matrix must be square to calculate the determinant");
+  }
+  double result = 0;
+  if (rows_ == 1) {
+    result = matrix_[0][0];
+  } else if (rows_ == 2) {
+    result = matrix_[0][0] * matrix_[1][1] - matrix_[0][1] * matrix_[1][0];
+  } else {
+    result = GetFactorization().det;
+    if (!cache_enabled_) InvalidateCache();
+  }
+
+  return result;
+}
+
+S21Matrix S21Matrix::InverseMatrix() const {
+  S21_TELEMETRY_SCOPE(S21Op::kInverseMatrix, 1LL * rows_ * cols_);
+  if (rows_ != cols_) {
+    throw std::logic_error(
+        "The matrix must be square to calculate the inverse matrix");
+  }
+  if (factorization_ != nullptr && factorization_->inverse) {
+    return *factorization_->inverse;
+  }
+
+  Factorization& f = GetFactorization();
+  if (f.singular || f.det == 0.0) {
+    if (!cache_enabled_) InvalidateCache();
+    throw std::logic_error("The determinant of the matrix is 0.");
+  }
+
+  S21Matrix result(rows_, cols_);
+  S21ParallelFor(0, cols_, ColumnGrain(rows_), [&](int from, int to) {
+    std::vector<double> column(rows_);
+    for (int j = from; j < to; ++j) {
+      std::fill(column.begin(), column.end(), 0.0);
+      column[j] = 1.0;
+      f.SolveInPlace(column.data());
+      for (int i = 0; i < rows_; ++i) result.matrix_[i][j] = column[i];
+    }
+  });
+
+  if (cache_enabled_) {
+    f.inverse = std::make_unique<S21Matrix>(result);
+  } else {
+    InvalidateCache();
+  }
+
+  return result;
+}
+
+S21Matrix S21Matrix::Solve(const S21Matrix& b) const {
+  S21_TELEMETRY_SCOPE(S21Op::kSolve, 1LL * b.rows_ * b.cols_);
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix must be square to solve a system");
+  }
+  if (b.rows_ != rows_) {
+    throw std::logic_error("Right-hand side rows must be equal matrix rows");
+  }
+
+  Factorization& f = GetFactorization();
+  if (f.singular) {
+    if (!cache_enabled_) InvalidateCache();
+    throw std::logic_error("The determinant of the matrix is 0.");
+  }
+
+  S21Matrix result(b.rows_, b.cols_);
+  S21ParallelFor(0, b.cols_, ColumnGrain(rows_), [&](int from, int to) {
+    std::vector<double> column(rows_);
+    for (int j = from; j < to; ++j) {
+      for (int i = 0; i < rows_; ++i) column[i] = b.matrix_[i][j];
+      f.SolveInPlace(column.data());
+      for (int i = 0; i < rows_; ++i) result.matrix_[i][j] = column[i];
+    }
+  });
+  if (!cache_enabled_) InvalidateCache();
+
+  return result;
+}
+
+int S21Matrix::Rank() const {
+  S21_TELEMETRY_SCOPE(S21Op::kRank, 1LL * rows_ * cols_);
+  if (factorization_ != nullptr && factorization_->rank >= 0) {
+    return factorization_->rank;
+  }
+
+  // Метод Гаусса с полным выбором ведущего элемента
+  S21Matrix a(*this);
+  a.Detach();
+  double** m = a.matrix_;
+  double tolerance = PivotTolerance(*this);
+  int rank = 0;
+  int limit = std::min(rows_, cols_);
+  std::vector<int> col_order(cols_);
+  for (int j = 0; j < cols_; ++j) col_order[j] = j;
+
+  for (int k = 0; k < limit; ++k) {
+    int pr = k, pc = k;
+    for (int i = k; i < rows_; ++i) {
+      for (int j = k; j < cols_; ++j) {
+        if (std::fabs(m[i][col_order[j]]) >
+            std::fabs(m[pr][col_order[pc]])) {
+          pr = i;
+          pc = j;
+        }
+      }
+    }
+    if (std::fabs(m[pr][col_order[pc]]) <= tolerance) break;
+    std::swap_ranges(m[k], m[k] + cols_, m[pr]);
+    std::swap(col_order[k], col_order[pc]);
+    double pivot = m[k][col_order[k]];
+    for (int i = k + 1; i < rows_; ++i) {
+      double l = m[i][col_order[k]] / pivot;
+      if (l == 0.0) continue;
+      for (int j = k; j < cols_; ++j) {
+        m[i][col_order[j]] -= l * m[k][col_order[j]];
+      }
+    }
+    ++rank;
+  }
+
+  if (cache_enabled_) {
+    if (factorization_ == nullptr) factorization_ = new Factorization();
+    factorization_->rank = rank;
+  }
+
+  return rank;
+}
+
+bool S21Matrix::LowRankUpdate(const S21Matrix& u, const S21Matrix& c,
+                              const S21Matrix& v) {
+  int n = rows_, k = c.rows_;
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix must be square to update it");
+  }
+  if (c.cols_ != k || u.rows_ != n || u.cols_ != k || v.rows_ != n ||
+      v.cols_ != k) {
+    throw std::logic_error("Update dimensions do not match the matrix");
+  }
+  S21_TELEMETRY_SCOPE(S21Op::kLowRankUpdate, 1LL * n * n, 32LL * n * n,
+                      6LL * n * n * k);
+  // Кэш забирается до изменения матрицы, иначе его удалит InvalidateCache
+  std::unique_ptr<Factorization> cache(factorization_);
+  factorization_ = nullptr;
+
+  S21Matrix uc(n, k);
+  uc.Gemm(1.0, u, c, 0.0);
+  Gemm(1.0, uc, v, 1.0, false, true);
+
+  if (!cache || !cache_enabled_ || !cache->lu || cache->singular ||
+      cache->updates >= kMaxUpdates) {
+    return false;
+  }
+
+  // W = A^{-1} U по старой матрице: из обратной или из LU с поправками
+  S21Matrix w(n, k);
+  if (cache->inverse) {
+    w.Gemm(1.0, *cache->inverse, u, 0.0);
+  } else {
+    std::vector<double> column(n);
+    for (int j = 0; j < k; ++j) {
+      for (int i = 0; i < n; ++i) column[i] = u.matrix_[i][j];
+      cache->SolveInPlace(column.data());
+      for (int i = 0; i < n; ++i) w.matrix_[i][j] = column[i];
+    }
+  }
+
+  // det(A + U C V^T) = det(A) det(M), M = I + C V^T W
+  S21Matrix vw(k, k), cvw(k, k);
+  vw.Gemm(1.0, v, w, 0.0, true, false);
+  cvw.Gemm(1.0, c, vw, 0.0);
+  S21Matrix m(cvw);
+  for (int i = 0; i < k; ++i) m(i, i) += 1.0;
+  if (m.Rank() < k) return false;
+  // Rank выбирает ведущие элементы полностью, LU — по столбцу, и
+  // на границе вырожденности они могут разойтись
+  S21Matrix m_inv;
+  try {
+    m_inv = m.InverseMatrix();
+  } catch (const std::logic_error&) {
+    return false;
+  }
+  // Сокращение в M (при k = 1 — в 1 + c v^T w) означает потерю точности
+  double growth = m_inv.Norm1() * (1.0 + cvw.Norm1());
+  if (!(growth <= kMaxGrowth)) return false;
+
+  // (A + U C V^T)^{-1} = A^{-1} - W T V^T A^{-1}, T = M^{-1} C
+  S21Matrix t(k, k);
+  t.Gemm(1.0, m_inv, c, 0.0);
+  if (cache->inverse) {
+    S21Matrix z(k, n), y(k, n);
+    z.Gemm(1.0, v, *cache->inverse, 0.0, true, false);
+    y.Gemm(1.0, t, z, 0.0);
+    cache->inverse->Gemm(-1.0, w, y, 1.0);
+  }
+  // Старое LU остаётся: Solve и InverseMatrix применяют поправки к его
+  // решениям за O(k n) на столбец вместо нового разложения
+  S21Matrix v_copy(v);
+  v_copy.Detach();  // v может быть видом чужого буфера
+  cache->corrections.push_back(
+      {std::move(w), std::move(t), std::move(v_copy)});
+  cache->det *= m.Determinant();
+  cache->rank = -1;
+  ++cache->updates;
+  factorization_ = cache.release();
+  return true;
+}
+
+bool S21Matrix::RankOneUpdate(const S21Vector& u, const S21Vector& v) {
+  if (u.GetSize() != rows_ || v.GetSize() != cols_) {
+    throw std::logic_error("Update dimensions do not match the matrix");
+  }
+  S21Matrix um(rows_, 1), vm(cols_, 1), c(1, 1);
+  for (int i = 0; i < rows_; ++i) um.matrix_[i][0] = u(i);
+  for (int i = 0; i < cols_; ++i) vm.matrix_[i][0] = v(i);
+  c.matrix_[0][0] = 1.0;
+  return LowRankUpdate(um, c, vm);
+}
+
+bool S21Matrix::ReplaceRow(int i, const S21Vector& row) {
+  if (i < 0 || i >= rows_) {
+    throw std::out_of_range("Index is outside the matrix");
+  }
+  if (row.GetSize() != cols_) {
+    throw std::logic_error("Row size must be equal matrix cols");
+  }
+  if (rows_ != cols_) {
+    std::copy(row.Data(), row.Data() + cols_, Row(i));
+    return false;
+  }
+  // Замена строки — поправка e_i (row - a_i)^T
+  S21Vector u(rows_), v(cols_);
+  u(i) = 1.0;
+  for (int j = 0; j < cols_; ++j) v(j) = row(j) - matrix_[i][j];
+  return RankOneUpdate(u, v);
+}
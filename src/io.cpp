@@ -0,0 +1,697 @@
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+#include "s21_io.h"
+
+namespace {
+
+constexpr std::size_t kChunk = 1 << 16;  // элементов на порцию конвертации
+constexpr int kTile = 32;
+
+constexpr std::uint32_t kLocalSignature = 0x04034b50;
+constexpr std::uint32_t kCentralSignature = 0x02014b50;
+constexpr std::uint32_t kEndSignature = 0x06054b50;
+constexpr std::uint32_t kZip64EndSignature = 0x06064b50;
+constexpr std::uint32_t kZip64LocatorSignature = 0x07064b50;
+constexpr std::uint64_t kZip64Limit = 0xFFFFFFFF;
+constexpr std::uint16_t kDosDate = (1 << 5) | 1;  // 1980-01-01
+
+bool HostIsLittleEndian() {
+  std::uint16_t value = 1;
+  unsigned char first = 0;
+  std::memcpy(&first, &value, 1);
+  return first == 1;
+}
+
+std::uint32_t Crc32(std::uint32_t crc, const void* data, std::size_t size) {
+  static const std::array<std::uint32_t, 256> table = [] {
+    std::array<std::uint32_t, 256> t{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+      std::uint32_t c = i;
+      for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      t[i] = c;
+    }
+    return t;
+  }();
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  crc = ~crc;
+  for (std::size_t i = 0; i < size; ++i) {
+    crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+// Поток байтов с подсчётом объёма и, для записей .npz, CRC-32
+class Source {
+ public:
+  Source(std::istream& in, bool track_crc) : in_(in), track_(track_crc) {}
+
+  void Read(void* dst, std::size_t size) {
+    in_.read(static_cast<char*>(dst), static_cast<std::streamsize>(size));
+    if (static_cast<std::size_t>(in_.gcount()) != size) {
+      throw std::runtime_error("Unexpected end of npy data");
+    }
+    if (track_) crc_ = Crc32(crc_, dst, size);
+    count_ += size;
+  }
+  std::uint32_t Crc() const { return crc_; }
+  std::uint64_t Count() const { return count_; }
+
+ private:
+  std::istream& in_;
+  bool track_;
+  std::uint32_t crc_ = 0;
+  std::uint64_t count_ = 0;
+};
+
+class Sink {
+ public:
+  Sink(std::ostream& out, bool track_crc) : out_(out), track_(track_crc) {}
+
+  void Write(const void* src, std::size_t size) {
+    out_.write(static_cast<const char*>(src),
+               static_cast<std::streamsize>(size));
+    if (!out_) throw std::runtime_error("Cannot write npy data");
+    if (track_) crc_ = Crc32(crc_, src, size);
+    count_ += size;
+  }
+  std::uint32_t Crc() const { return crc_; }
+  std::uint64_t Count() const { return count_; }
+
+ private:
+  std::ostream& out_;
+  bool track_;
+  std::uint32_t crc_ = 0;
+  std::uint64_t count_ = 0;
+};
+
+struct NpyHeader {
+  S21DType type = S21DType::kFloat64;
+  bool swap = false;  // порядок байтов отличается от машинного
+  bool fortran = false;
+  int rows = 0, cols = 0;
+};
+
+std::size_t ElementSize(S21DType type) {
+  return type == S21DType::kFloat64 ? sizeof(double) : sizeof(float);
+}
+
+void SwapBytes(void* data, std::size_t count, std::size_t width) {
+  char* bytes = static_cast<char*>(data);
+  for (std::size_t i = 0; i < count; ++i) {
+    std::reverse(bytes + i * width, bytes + (i + 1) * width);
+  }
+}
+
+bool IsContiguous(const S21Matrix& m) {
+  return m.GetRows() == 1 || m.Row(1) - m.Row(0) == m.GetCols();
+}
+
+// Раскладывает w столбцов, лежащих подряд по rows элементов,
+// в столбцы j0..j0+w-1; обход плитками ради локальности кэша
+template <class T>
+void ScatterColumns(const T* src, int j0, int w, S21Matrix& m) {
+  int rows = m.GetRows();
+  for (int i0 = 0; i0 < rows; i0 += kTile) {
+    int i_end = std::min(rows, i0 + kTile);
+    for (int c0 = 0; c0 < w; c0 += kTile) {
+      int c_end = std::min(w, c0 + kTile);
+      for (int i = i0; i < i_end; ++i) {
+        double* row = m.Row(i) + j0;
+        for (int c = c0; c < c_end; ++c) {
+          row[c] = static_cast<double>(src[1LL * c * rows + i]);
+        }
+      }
+    }
+  }
+}
+
+template <class T>
+void GatherColumns(const S21Matrix& m, int j0, int w, T* dst) {
+  int rows = m.GetRows();
+  for (int i0 = 0; i0 < rows; i0 += kTile) {
+    int i_end = std::min(rows, i0 + kTile);
+    for (int c0 = 0; c0 < w; c0 += kTile) {
+      int c_end = std::min(w, c0 + kTile);
+      for (int i = i0; i < i_end; ++i) {
+        const double* row = m.Row(i) + j0;
+        for (int c = c0; c < c_end; ++c) {
+          dst[1LL * c * rows + i] = static_cast<T>(row[c]);
+        }
+      }
+    }
+  }
+}
+
+template <class T>
+S21Matrix FromBuffer(const T* data, int rows, int cols, S21Layout layout) {
+  S21Matrix m(rows, cols);
+  if (data == nullptr) throw std::invalid_argument("Buffer is null");
+  if (layout == S21Layout::kColumnMajor) {
+    ScatterColumns(data, 0, cols, m);
+  } else {
+    for (int i = 0; i < rows; ++i) {
+      std::copy(data + 1LL * i * cols, data + 1LL * (i + 1) * cols,
+                m.Row(i));
+    }
+  }
+  return m;
+}
+
+template <class T>
+void ToBuffer(const S21Matrix& m, T* out, S21Layout layout) {
+  if (out == nullptr) throw std::invalid_argument("Buffer is null");
+  int rows = m.GetRows(), cols = m.GetCols();
+  if (layout == S21Layout::kColumnMajor) {
+    GatherColumns(m, 0, cols, out);
+  } else {
+    for (int i = 0; i < rows; ++i) {
+      std::transform(m.Row(i), m.Row(i) + cols, out + 1LL * i * cols,
+                     [](double v) { return static_cast<T>(v); });
+    }
+  }
+}
+
+// Читает count элементов; float64 машинного порядка — прямо в dst
+void ReadValues(Source& src, const NpyHeader& header, double* dst,
+                std::size_t count) {
+  if (header.type == S21DType::kFloat64) {
+    src.Read(dst, count * sizeof(double));
+    if (header.swap) SwapBytes(dst, count, sizeof(double));
+    return;
+  }
+  std::vector<float> buffer(std::min(count, kChunk));
+  for (std::size_t done = 0; done < count;) {
+    std::size_t n = std::min(count - done, kChunk);
+    src.Read(buffer.data(), n * sizeof(float));
+    if (header.swap) SwapBytes(buffer.data(), n, sizeof(float));
+    std::copy(buffer.begin(), buffer.begin() + n, dst + done);
+    done += n;
+  }
+}
+
+void WriteValues(Sink& sink, S21DType type, const double* src,
+                 std::size_t count) {
+  if (type == S21DType::kFloat64) {
+    sink.Write(src, count * sizeof(double));
+    return;
+  }
+  std::vector<float> buffer(std::min(count, kChunk));
+  for (std::size_t done = 0; done < count;) {
+    std::size_t n = std::min(count - done, kChunk);
+    for (std::size_t i = 0; i < n; ++i) {
+      buffer[i] = static_cast<float>(src[done + i]);
+    }
+    sink.Write(buffer.data(), n * sizeof(float));
+    done += n;
+  }
+}
+
+// Значение ключа словаря заголовка: текст после "'key':"
+std::string HeaderValue(const std::string& header, const std::string& key) {
+  std::size_t pos = header.find("'" + key + "'");
+  if (pos == std::string::npos) pos = header.find("\"" + key + "\"");
+  if (pos == std::string::npos) {
+    throw std::runtime_error("npy header has no '" + key + "'");
+  }
+  pos = header.find(':', pos);
+  if (pos == std::string::npos) throw std::runtime_error("Bad npy header");
+  pos = header.find_first_not_of(' ', pos + 1);
+  if (pos == std::string::npos) throw std::runtime_error("Bad npy header");
+  return header.substr(pos);
+}
+
+int ParseDimension(const std::string& token) {
+  long long value = std::stoll(token);
+  if (value < 1 || value > INT_MAX) {
+    throw std::invalid_argument("npy dimension is out of range");
+  }
+  return static_cast<int>(value);
+}
+
+NpyHeader ParseHeader(const std::string& text) {
+  NpyHeader header;
+
+  std::string descr = HeaderValue(text, "descr");
+  if (descr.size() < 5 || (descr[0] != '\'' && descr[0] != '"') ||
+      descr[4] != descr[0] || descr[2] != 'f' ||
+      (descr[3] != '4' && descr[3] != '8')) {
+    throw std::invalid_argument("Only float32 and float64 npy are supported");
+  }
+  char order = descr[1];
+  if (order != '<' && order != '>' && order != '=') {
+    throw std::invalid_argument("Only float32 and float64 npy are supported");
+  }
+  header.type = descr[3] == '8' ? S21DType::kFloat64 : S21DType::kFloat32;
+  header.swap = (order == '<' && !HostIsLittleEndian()) ||
+                (order == '>' && HostIsLittleEndian());
+
+  std::string fortran = HeaderValue(text, "fortran_order");
+  if (fortran.compare(0, 4, "True") == 0) {
+    header.fortran = true;
+  } else if (fortran.compare(0, 5, "False") != 0) {
+    throw std::runtime_error("Bad npy fortran_order");
+  }
+
+  std::string shape = HeaderValue(text, "shape");
+  std::size_t end = shape.find(')');
+  if (shape[0] != '(' || end == std::string::npos) {
+    throw std::runtime_error("Bad npy shape");
+  }
+  std::vector<int> dims;
+  std::size_t pos = 1;
+  while (pos < end) {
+    std::size_t comma = std::min(shape.find(',', pos), end);
+    std::string token = shape.substr(pos, comma - pos);
+    if (token.find_first_not_of(' ') != std::string::npos) {
+      dims.push_back(ParseDimension(token));
+    }
+    pos = comma + 1;
+  }
+  if (dims.size() > 2) {
+    throw std::invalid_argument("Only 1-D and 2-D npy arrays are supported");
+  }
+  header.rows = dims.empty() ? 1 : dims[0];
+  header.cols = dims.size() == 2 ? dims[1] : 1;
+  return header;
+}
+
+NpyHeader ReadHeader(Source& src) {
+  unsigned char prefix[8];
+  src.Read(prefix, sizeof(prefix));
+  if (std::memcmp(prefix, "\x93NUMPY", 6) != 0) {
+    throw std::runtime_error("Not an npy file");
+  }
+  std::uint32_t length = 0;
+  if (prefix[6] == 1) {
+    unsigned char bytes[2];
+    src.Read(bytes, 2);
+    length = bytes[0] | bytes[1] << 8;
+  } else if (prefix[6] == 2 || prefix[6] == 3) {
+    unsigned char bytes[4];
+    src.Read(bytes, 4);
+    length = bytes[0] | bytes[1] << 8 | bytes[2] << 16 |
+             static_cast<std::uint32_t>(bytes[3]) << 24;
+  } else {
+    throw std::runtime_error("Unsupported npy version");
+  }
+  std::string text(length, '\0');
+  src.Read(text.data(), length);
+  return ParseHeader(text);
+}
+
+std::string MakeHeader(S21DType type, bool fortran, int rows, int cols) {
+  std::string dict = "{'descr': '";
+  dict += HostIsLittleEndian() ? '<' : '>';
+  dict += type == S21DType::kFloat64 ? "f8" : "f4";
+  dict += "', 'fortran_order': ";
+  dict += fortran ? "True" : "False";
+  dict += ", 'shape': (" + std::to_string(rows) + ", " +
+          std::to_string(cols) + "), }";
+  // Данные начинаются с границы 64 байт
+  std::size_t total = 10 + dict.size() + 1;
+  dict.append((64 - total % 64) % 64, ' ');
+  dict += '\n';
+
+  std::string result("\x93NUMPY\x01\x00", 8);
+  result += static_cast<char>(dict.size() & 0xFF);
+  result += static_cast<char>(dict.size() >> 8);
+  return result + dict;
+}
+
+S21Matrix ReadMatrix(Source& src) {
+  NpyHeader header = ReadHeader(src);
+  S21Matrix m(header.rows, header.cols);
+  int rows = header.rows, cols = header.cols;
+  if (!header.fortran || rows == 1 || cols == 1) {
+    if (IsContiguous(m)) {
+      ReadValues(src, header, m.Row(0), 1ULL * rows * cols);
+    } else {
+      for (int i = 0; i < rows; ++i) ReadValues(src, header, m.Row(i), cols);
+    }
+  } else {
+    // Порядок Fortran: столбцы читаются порциями и раскладываются по строкам
+    int width = std::max(1, static_cast<int>(kChunk / rows));
+    width = std::min(width, cols);
+    std::vector<double> buffer(1ULL * width * rows);
+    for (int j0 = 0; j0 < cols; j0 += width) {
+      int w = std::min(width, cols - j0);
+      ReadValues(src, header, buffer.data(), 1ULL * w * rows);
+      ScatterColumns(buffer.data(), j0, w, m);
+    }
+  }
+  return m;
+}
+
+void WriteMatrix(Sink& sink, const S21Matrix& m, S21DType type,
+                 bool fortran) {
+  std::string header = MakeHeader(type, fortran, m.GetRows(), m.GetCols());
+  sink.Write(header.data(), header.size());
+  int rows = m.GetRows(), cols = m.GetCols();
+  if (!fortran || rows == 1 || cols == 1) {
+    if (IsContiguous(m)) {
+      WriteValues(sink, type, m.Row(0), 1ULL * rows * cols);
+    } else {
+      for (int i = 0; i < rows; ++i) WriteValues(sink, type, m.Row(i), cols);
+    }
+  } else {
+    int width = std::max(1, static_cast<int>(kChunk / rows));
+    width = std::min(width, cols);
+    std::vector<double> buffer(1ULL * width * rows);
+    for (int j0 = 0; j0 < cols; j0 += width) {
+      int w = std::min(width, cols - j0);
+      GatherColumns(m, j0, w, buffer.data());
+      WriteValues(sink, type, buffer.data(), 1ULL * w * rows);
+    }
+  }
+}
+
+void Put(std::string& out, std::uint64_t value, int bytes) {
+  for (int i = 0; i < bytes; ++i) {
+    out += static_cast<char>((value >> (8 * i)) & 0xFF);
+  }
+}
+
+std::uint64_t Get(const char* data, int bytes) {
+  std::uint64_t value = 0;
+  for (int i = bytes - 1; i >= 0; --i) {
+    value = value << 8 | static_cast<unsigned char>(data[i]);
+  }
+  return value;
+}
+
+void ReadAt(std::ifstream& in, std::uint64_t offset, char* dst,
+            std::size_t size) {
+  in.clear();
+  in.seekg(static_cast<std::streamoff>(offset));
+  in.read(dst, static_cast<std::streamsize>(size));
+  if (static_cast<std::size_t>(in.gcount()) != size) {
+    throw std::runtime_error("Truncated npz archive");
+  }
+}
+
+}  // namespace
+
+S21Matrix S21FromBuffer(const double* data, int rows, int cols,
+                        S21Layout layout) {
+  return FromBuffer(data, rows, cols, layout);
+}
+
+S21Matrix S21FromBuffer(const float* data, int rows, int cols,
+                        S21Layout layout) {
+  return FromBuffer(data, rows, cols, layout);
+}
+
+void S21ToBuffer(const S21Matrix& m, double* out, S21Layout layout) {
+  ToBuffer(m, out, layout);
+}
+
+void S21ToBuffer(const S21Matrix& m, float* out, S21Layout layout) {
+  ToBuffer(m, out, layout);
+}
+
+S21Matrix S21ReadNpy(std::istream& in) {
+  Source src(in, false);
+  return ReadMatrix(src);
+}
+
+void S21WriteNpy(std::ostream& out, const S21Matrix& m, S21DType type,
+                 S21Layout layout) {
+  Sink sink(out, false);
+  WriteMatrix(sink, m, type, layout == S21Layout::kColumnMajor);
+}
+
+S21Matrix S21LoadNpy(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) throw std::runtime_error("Cannot open " + path);
+  return S21ReadNpy(in);
+}
+
+void S21SaveNpy(const std::string& path, const S21Matrix& m, S21DType type,
+                S21Layout layout) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) throw std::runtime_error("Cannot open " + path);
+  S21WriteNpy(out, m, type, layout);
+  out.flush();
+  if (!out) throw std::runtime_error("Cannot write " + path);
+}
+
+S21NpzReader::S21NpzReader(const std::string& path)
+    : in_(path, std::ios::binary) {
+  if (!in_) throw std::runtime_error("Cannot open " + path);
+  in_.seekg(0, std::ios::end);
+  std::uint64_t file_size = static_cast<std::uint64_t>(in_.tellg());
+
+  // Конец центрального каталога ищется с конца: за ним может идти комментарий
+  std::size_t tail_size =
+      static_cast<std::size_t>(std::min<std::uint64_t>(file_size, 65557));
+  std::string tail(tail_size, '\0');
+  ReadAt(in_, file_size - tail_size, tail.data(), tail_size);
+  long long end = -1;
+  for (long long pos = static_cast<long long>(tail_size) - 22; pos >= 0;
+       --pos) {
+    if (Get(tail.data() + pos, 4) == kEndSignature) {
+      end = pos;
+      break;
+    }
+  }
+  if (end < 0) throw std::runtime_error("Not a zip archive");
+
+  const char* record = tail.data() + end;
+  std::uint64_t count = Get(record + 10, 2);
+  std::uint64_t cd_size = Get(record + 12, 4);
+  std::uint64_t cd_offset = Get(record + 16, 4);
+  if (count == 0xFFFF || cd_size == kZip64Limit || cd_offset == kZip64Limit) {
+    std::uint64_t end_offset = file_size - tail_size + end;
+    char locator[20];
+    if (end_offset < sizeof(locator)) {
+      throw std::runtime_error("Bad zip64 archive");
+    }
+    ReadAt(in_, end_offset - sizeof(locator), locator, sizeof(locator));
+    if (Get(locator, 4) != kZip64LocatorSignature) {
+      throw std::runtime_error("Bad zip64 archive");
+    }
+    char zip64_end[56];
+    ReadAt(in_, Get(locator + 8, 8), zip64_end, sizeof(zip64_end));
+    if (Get(zip64_end, 4) != kZip64EndSignature) {
+      throw std::runtime_error("Bad zip64 archive");
+    }
+    count = Get(zip64_end + 32, 8);
+    cd_size = Get(zip64_end + 40, 8);
+    cd_offset = Get(zip64_end + 48, 8);
+  }
+  if (cd_offset + cd_size > file_size) {
+    throw std::runtime_error("Truncated npz archive");
+  }
+
+  std::string directory(cd_size, '\0');
+  ReadAt(in_, cd_offset, directory.data(), cd_size);
+  std::size_t pos = 0;
+  for (std::uint64_t k = 0; k < count; ++k) {
+    if (pos + 46 > directory.size() ||
+        Get(directory.data() + pos, 4) != kCentralSignature) {
+      throw std::runtime_error("Bad zip central directory");
+    }
+    const char* header = directory.data() + pos;
+    Entry entry;
+    entry.method = static_cast<std::uint16_t>(Get(header + 10, 2));
+    entry.crc = static_cast<std::uint32_t>(Get(header + 16, 4));
+    std::uint64_t packed = Get(header + 20, 4);
+    entry.size = Get(header + 24, 4);
+    entry.offset = Get(header + 42, 4);
+    std::size_t name_len = Get(header + 28, 2);
+    std::size_t extra_len = Get(header + 30, 2);
+    std::size_t comment_len = Get(header + 32, 2);
+    if (pos + 46 + name_len + extra_len + comment_len > directory.size()) {
+      throw std::runtime_error("Bad zip central directory");
+    }
+    std::string name(header + 46, name_len);
+
+    // Поле ZIP64 содержит только те величины, что не уместились в 32 бита
+    const char* extra = header + 46 + name_len;
+    for (std::size_t x = 0; x + 4 <= extra_len;) {
+      std::uint64_t id = Get(extra + x, 2);
+      std::size_t len = Get(extra + x + 2, 2);
+      if (id == 1) {
+        const char* field = extra + x + 4;
+        std::size_t used = 0;
+        for (std::uint64_t* value : {&entry.size, &packed, &entry.offset}) {
+          if (*value == kZip64Limit && used + 8 <= len) {
+            *value = Get(field + used, 8);
+            used += 8;
+          }
+        }
+      }
+      x += 4 + len;
+    }
+    pos += 46 + name_len + extra_len + comment_len;
+
+    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".npy") == 0) {
+      name.resize(name.size() - 4);
+    }
+    names_.push_back(name);
+    entries_.push_back(entry);
+  }
+}
+
+bool S21NpzReader::Contains(const std::string& name) const {
+  return std::find(names_.begin(), names_.end(), name) != names_.end();
+}
+
+S21Matrix S21NpzReader::Load(const std::string& name) {
+  auto it = std::find(names_.begin(), names_.end(), name);
+  if (it == names_.end()) throw std::out_of_range("No array named " + name);
+  const Entry& entry = entries_[it - names_.begin()];
+  if (entry.method != 0) {
+    throw std::runtime_error("Compressed npz entries are not supported");
+  }
+
+  char local[30];
+  ReadAt(in_, entry.offset, local, sizeof(local));
+  if (Get(local, 4) != kLocalSignature) {
+    throw std::runtime_error("Bad zip local header");
+  }
+  in_.seekg(static_cast<std::streamoff>(entry.offset + sizeof(local) +
+                                        Get(local + 26, 2) +
+                                        Get(local + 28, 2)));
+  Source src(in_, true);
+  S21Matrix result = ReadMatrix(src);
+  if (src.Count() != entry.size || src.Crc() != entry.crc) {
+    throw std::runtime_error("Corrupted npz entry " + name);
+  }
+  return result;
+}
+
+S21NpzWriter::S21NpzWriter(const std::string& path)
+    : out_(path, std::ios::binary | std::ios::trunc) {
+  if (!out_) throw std::runtime_error("Cannot open " + path);
+}
+
+S21NpzWriter::~S21NpzWriter() {
+  try {
+    Close();
+  } catch (...) {
+  }
+}
+
+void S21NpzWriter::Add(const std::string& name, const S21Matrix& m,
+                       S21DType type) {
+  if (closed_) throw std::logic_error("Npz archive is closed");
+  Entry entry;
+  entry.name = name + ".npy";
+  entry.size = MakeHeader(type, false, m.GetRows(), m.GetCols()).size() +
+               1ULL * m.GetRows() * m.GetCols() * ElementSize(type);
+  entry.offset = static_cast<std::uint64_t>(out_.tellp());
+  bool zip64 = entry.size >= kZip64Limit;
+
+  // Размер известен заранее, CRC дописывается после данных
+  std::string local;
+  Put(local, kLocalSignature, 4);
+  Put(local, zip64 ? 45 : 20, 2);
+  Put(local, 0, 2);  // флаги
+  Put(local, 0, 2);  // без сжатия
+  Put(local, 0, 2);
+  Put(local, kDosDate, 2);
+  Put(local, 0, 4);  // CRC-32
+  Put(local, zip64 ? kZip64Limit : entry.size, 4);
+  Put(local, zip64 ? kZip64Limit : entry.size, 4);
+  Put(local, entry.name.size(), 2);
+  Put(local, zip64 ? 20 : 0, 2);
+  local += entry.name;
+  if (zip64) {
+    Put(local, 1, 2);
+    Put(local, 16, 2);
+    Put(local, entry.size, 8);
+    Put(local, entry.size, 8);
+  }
+  Sink(out_, false).Write(local.data(), local.size());
+
+  Sink sink(out_, true);
+  WriteMatrix(sink, m, type, false);
+  entry.crc = sink.Crc();
+
+  std::string crc;
+  Put(crc, entry.crc, 4);
+  out_.seekp(static_cast<std::streamoff>(entry.offset + 14));
+  out_.write(crc.data(), 4);
+  out_.seekp(0, std::ios::end);
+  if (!out_) throw std::runtime_error("Cannot write npz archive");
+  entries_.push_back(entry);
+}
+
+void S21NpzWriter::Close() {
+  if (closed_) return;
+  closed_ = true;
+
+  std::uint64_t cd_offset = static_cast<std::uint64_t>(out_.tellp());
+  std::string directory;
+  for (const Entry& entry : entries_) {
+    bool big_size = entry.size >= kZip64Limit;
+    bool big_offset = entry.offset >= kZip64Limit;
+    std::size_t extra_len = (big_size ? 16 : 0) + (big_offset ? 8 : 0);
+    Put(directory, kCentralSignature, 4);
+    Put(directory, extra_len ? 45 : 20, 2);
+    Put(directory, extra_len ? 45 : 20, 2);
+    Put(directory, 0, 2);
+    Put(directory, 0, 2);
+    Put(directory, 0, 2);
+    Put(directory, kDosDate, 2);
+    Put(directory, entry.crc, 4);
+    Put(directory, big_size ? kZip64Limit : entry.size, 4);
+    Put(directory, big_size ? kZip64Limit : entry.size, 4);
+    Put(directory, entry.name.size(), 2);
+    Put(directory, extra_len ? extra_len + 4 : 0, 2);
+    Put(directory, 0, 2);  // комментарий
+    Put(directory, 0, 2);  // номер диска
+    Put(directory, 0, 2);
+    Put(directory, 0, 4);
+    Put(directory, big_offset ? kZip64Limit : entry.offset, 4);
+    directory += entry.name;
+    if (extra_len) {
+      Put(directory, 1, 2);
+      Put(directory, extra_len, 2);
+      if (big_size) {
+        Put(directory, entry.size, 8);
+        Put(directory, entry.size, 8);
+      }
+      if (big_offset) Put(directory, entry.offset, 8);
+    }
+  }
+  std::uint64_t cd_size = directory.size();
+  std::uint64_t count = entries_.size();
+
+  if (count >= 0xFFFF || cd_size >= kZip64Limit || cd_offset >= kZip64Limit) {
+    std::uint64_t zip64_offset = cd_offset + cd_size;
+    Put(directory, kZip64EndSignature, 4);
+    Put(directory, 44, 8);
+    Put(directory, 45, 2);
+    Put(directory, 45, 2);
+    Put(directory, 0, 4);
+    Put(directory, 0, 4);
+    Put(directory, count, 8);
+    Put(directory, count, 8);
+    Put(directory, cd_size, 8);
+    Put(directory, cd_offset, 8);
+    Put(directory, kZip64LocatorSignature, 4);
+    Put(directory, 0, 4);
+    Put(directory, zip64_offset, 8);
+    Put(directory, 1, 4);
+  }
+  Put(directory, kEndSignature, 4);
+  Put(directory, 0, 2);
+  Put(directory, 0, 2);
+  Put(directory, std::min<std::uint64_t>(count, 0xFFFF), 2);
+  Put(directory, std::min<std::uint64_t>(count, 0xFFFF), 2);
+  Put(directory, std::min(cd_size, kZip64Limit), 4);
+  Put(directory, std::min(cd_offset, kZip64Limit), 4);
+  Put(directory, 0, 2);
+
+  out_.write(directory.data(), static_cast<std::streamsize>(directory.size()));
+  out_.close();
+  if (!out_) throw std::runtime_error("Cannot write npz archive");
+}
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+// LU-разложение во float: вдвое меньше памяти и пропускной способности
+struct FloatLu {
+  int n = 0;
+  std::vector<float> a;  // по строкам, n * n
+  std::vector<int> pivots;
+  bool ok = false;
+
+  float* Row(int i) { return a.data() + static_cast<long long>(i) * n; }
+  const float* Row(int i) const {
+    return a.data() + static_cast<long long>(i) * n;
+  }
+
+  void Factorize(double** m, int size) {
+    n = size;
+    a.resize(static_cast<long long>(n) * n);
+    pivots.assign(n, 0);
+    double max_abs = 0.0;
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        max_abs = std::max(max_abs, std::fabs(m[i][j]));
+        Row(i)[j] = static_cast<float>(m[i][j]);
+      }
+    }
+    // Значения вне диапазона float не переживут округления
+    ok = max_abs > 0.0 && max_abs < std::numeric_limits<float>::max() / n;
+    float tolerance =
+        n * std::numeric_limits<float>::epsilon() * static_cast<float>(max_abs);
+    for (int k = 0; k < n && ok; ++k) {
+      int p = k;
+      for (int i = k + 1; i < n; ++i) {
+        if (std::fabs(Row(i)[k]) > std::fabs(Row(p)[k])) p = i;
+      }
+      pivots[k] = p;
+      if (p != k) std::swap_ranges(Row(k), Row(k) + n, Row(p));
+      float* rk = Row(k);
+      if (std::fabs(rk[k]) <= tolerance) ok = false;
+      for (int i = k + 1; i < n && ok; ++i) {
+        float* ri = Row(i);
+        float l = ri[k] / rk[k];
+        ri[k] = l;
+        if (l == 0.0f) continue;
+        for (int j = k + 1; j < n; ++j) ri[j] -= l * rk[j];
+      }
+    }
+  }
+
+  void SolveInPlace(float* x) const {
+    for (int k = 0; k < n; ++k) {
+      if (pivots[k] != k) std::swap(x[k], x[pivots[k]]);
+    }
+    for (int i = 1; i < n; ++i) {
+      const float* ri = Row(i);
+      float sum = x[i];
+      for (int j = 0; j < i; ++j) sum -= ri[j] * x[j];
+      x[i] = sum;
+    }
+    for (int i = n - 1; i >= 0; --i) {
+      const float* ri = Row(i);
+      float sum = x[i];
+      for (int j = i + 1; j < n; ++j) sum -= ri[j] * x[j];
+      x[i] = sum / ri[i];
+    }
+  }
+};
+
+// Решение по столбцам правой части; при accumulate поправка
+// прибавляется к out в double
+void SolveColumns(const FloatLu& lu, double** rhs, int cols, double** out,
+                  bool accumulate) {
+  int n = lu.n;
+  long long work = std::max(1LL, static_cast<long long>(n) * n);
+  int grain = static_cast<int>(std::max(1LL, (1LL << 16) / work));
+  S21ParallelFor(0, cols, grain, [&](int from, int to) {
+    std::vector<float> column(n);
+    for (int j = from; j < to; ++j) {
+      for (int i = 0; i < n; ++i) column[i] = static_cast<float>(rhs[i][j]);
+      lu.SolveInPlace(column.data());
+      for (int i = 0; i < n; ++i) {
+        out[i][j] = accumulate ? out[i][j] + column[i] : column[i];
+      }
+    }
+  });
+}
+
+}  // namespace
+
+S21RefinementResult S21Matrix::SolveRefined(const S21Matrix& b,
+                                            int max_iterations,
+                                            double tolerance) const {
+  S21_TELEMETRY_SCOPE(S21Op::kSolveRefined, 1LL * b.rows_ * b.cols_);
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix must be square to solve a system");
+  }
+  if (b.rows_ != rows_) {
+    throw std::logic_error("Right-hand side rows must be equal matrix rows");
+  }
+  if (tolerance <= 0.0) {
+    tolerance = std::sqrt(static_cast<double>(rows_)) *
+                std::numeric_limits<double>::epsilon();
+  }
+
+  S21RefinementResult result{S21Matrix(b.rows_, b.cols_), 0,
+                             std::numeric_limits<double>::infinity(), false,
+                             false};
+  double a_norm = NormInf();
+  S21Matrix residual(b.rows_, b.cols_);
+  // Нормированная обратная ошибка: max_j |r_j| / (|A| |x_j|)
+  auto backward_error = [&]() {
+    for (int i = 0; i < rows_; ++i) {
+      std::copy(b.matrix_[i], b.matrix_[i] + b.cols_, residual.matrix_[i]);
+    }
+    residual.Gemm(-1.0, *this, result.solution, 1.0);
+    double worst = 0.0;
+    for (int j = 0; j < b.cols_; ++j) {
+      double r = 0.0, x = 0.0;
+      for (int i = 0; i < rows_; ++i) {
+        r = std::max(r, std::fabs(residual.matrix_[i][j]));
+        x = std::max(x, std::fabs(result.solution.matrix_[i][j]));
+      }
+      double scale = a_norm * x;
+      worst = std::max(worst, scale == 0.0 ? r : r / scale);
+    }
+    return worst;
+  };
+
+  FloatLu lu;
+  lu.Factorize(matrix_, rows_);
+  if (lu.ok) {
+    SolveColumns(lu, b.matrix_, b.cols_, result.solution.matrix_, false);
+    double previous = std::numeric_limits<double>::infinity();
+    for (;;) {
+      result.residual = backward_error();
+      if (result.residual <= tolerance) {
+        result.converged = true;
+        break;
+      }
+      // Без заметного уменьшения невязки уточнение не сойдётся
+      if (!(result.residual < 0.5 * previous) ||
+          result.iterations >= max_iterations) {
+        break;
+      }
+      previous = result.residual;
+      SolveColumns(lu, residual.matrix_, b.cols_, result.solution.matrix_,
+                   true);
+      ++result.iterations;
+    }
+  }
+
+  if (!result.converged) {
+    result.fallback = true;
+    result.solution = Solve(b);
+    result.residual = backward_error();
+  }
+  return result;
+}
@@ -0,0 +1,352 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "s21_executor.h"
+#include "s21_matrix_oop.h"
+#include "s21_numa.h"
+#include "s21_telemetry.h"
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr int kPolicyCount = 4;
+const char* const kPolicyNames[kPolicyCount] = {"default", "first-touch",
+                                                "interleave", "local"};
+
+S21NumaPolicy EnvPolicy() {
+  const char* value = std::getenv("S21_NUMA_POLICY");
+  if (value != nullptr) {
+    for (int p = 0; p < kPolicyCount; ++p) {
+      if (std::strcmp(value, kPolicyNames[p]) == 0) {
+        return static_cast<S21NumaPolicy>(p);
+      }
+    }
+  }
+  return S21NumaPolicy::kDefault;
+}
+
+bool EnvPinned() {
+  const char* value = std::getenv("S21_NUMA_PIN");
+  return value != nullptr && *value != '\0' && std::strcmp(value, "0") != 0;
+}
+
+std::atomic<S21NumaPolicy> g_policy{EnvPolicy()};
+std::atomic<bool> g_pinned{EnvPinned()};
+std::atomic<std::uint64_t> g_allocations[kPolicyCount];
+std::atomic<std::uint64_t> g_bytes[kPolicyCount];
+
+// "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}; так же записаны и узлы
+std::vector<int> ParseCpuList(const std::string& text) {
+  std::vector<int> cpus;
+  std::stringstream in(text);
+  std::string range;
+  while (std::getline(in, range, ',')) {
+    if (range.empty() || range[0] == '\n') continue;
+    int first = std::atoi(range.c_str()), last = first;
+    std::size_t dash = range.find('-');
+    if (dash != std::string::npos) last = std::atoi(range.c_str() + dash + 1);
+    for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+std::string FormatCpuList(const std::vector<int>& cpus) {
+  std::ostringstream out;
+  for (std::size_t i = 0; i < cpus.size();) {
+    std::size_t j = i;
+    while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) ++j;
+    if (i > 0) out << ',';
+    out << cpus[i];
+    if (j > i) out << '-' << cpus[j];
+    i = j + 1;
+  }
+  return out.str();
+}
+
+// "Node 0 MemTotal:  16318412 kB"
+std::uint64_t MemInfo(const std::string& path, const char* key) {
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::size_t at = line.find(key);
+    if (at != std::string::npos) {
+      return std::strtoull(line.c_str() + at + std::strlen(key), nullptr,
+                           10) *
+             1024;
+    }
+  }
+  return 0;
+}
+
+std::vector<S21NumaNode> LoadNodes() {
+  std::vector<S21NumaNode> nodes;
+  const std::string root = "/sys/devices/system/node/";
+  std::ifstream online(root + "online");
+  std::string text;
+  std::getline(online, text);
+  for (int id : ParseCpuList(text)) {
+    std::string dir = root + "node" + std::to_string(id) + "/";
+    std::ifstream cpulist(dir + "cpulist");
+    std::string cpus;
+    std::getline(cpulist, cpus);
+    nodes.push_back({id, ParseCpuList(cpus),
+                     MemInfo(dir + "meminfo", "MemTotal:"),
+                     MemInfo(dir + "meminfo", "MemFree:")});
+  }
+  if (nodes.empty()) {
+    S21NumaNode node{0, {}, 0, 0};
+    int count = static_cast<int>(std::thread::hardware_concurrency());
+    for (int cpu = 0; cpu < std::max(count, 1); ++cpu) {
+      node.cpus.push_back(cpu);
+    }
+    nodes.push_back(node);
+  }
+  return nodes;
+}
+
+#if defined(__linux__)
+// Маска процесса на момент первого обращения (taskset, cgroup):
+// закрепление не выходит за неё, а открепление к ней возвращает
+const cpu_set_t& ProcessAffinity() {
+  static const cpu_set_t mask = [] {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(getpid(), sizeof(set), &set) != 0) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) CPU_SET(cpu, &set);
+    }
+    return set;
+  }();
+  return mask;
+}
+#endif
+
+bool Allowed(int cpu) {
+#if defined(__linux__)
+  return cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &ProcessAffinity());
+#else
+  return cpu >= 0;
+#endif
+}
+
+// CPU по очереди с каждого узла: соседние блоки строк расходятся по узлам
+const std::vector<int>& PinOrder() {
+  static const std::vector<int> order = [] {
+    std::vector<int> result;
+    const std::vector<S21NumaNode>& nodes = S21Numa::Nodes();
+    for (std::size_t k = 0;; ++k) {
+      bool any = false;
+      for (const S21NumaNode& node : nodes) {
+        if (k >= node.cpus.size()) continue;
+        any = true;
+        if (Allowed(node.cpus[k])) result.push_back(node.cpus[k]);
+      }
+      if (!any) break;
+    }
+    if (result.empty()) result.push_back(0);
+    return result;
+  }();
+  return order;
+}
+
+}  // namespace
+
+const std::vector<S21NumaNode>& S21Numa::Nodes() {
+  static const std::vector<S21NumaNode> nodes = LoadNodes();
+  return nodes;
+}
+
+void S21Numa::SetPolicy(S21NumaPolicy policy) {
+  g_policy.store(policy, std::memory_order_relaxed);
+}
+
+S21NumaPolicy S21Numa::GetPolicy() {
+  return g_policy.load(std::memory_order_relaxed);
+}
+
+S21NumaPolicy S21Numa::PolicyFor(std::size_t bytes) {
+  return bytes < kMinBytes ? S21NumaPolicy::kDefault : GetPolicy();
+}
+
+void S21Numa::Bind(void* data, std::size_t bytes, S21NumaPolicy policy) {
+#if defined(__linux__)
+  if (policy != S21NumaPolicy::kInterleave &&
+      policy != S21NumaPolicy::kLocal) {
+    return;
+  }
+  // Политика задаётся целыми страницами внутри блока
+  std::uintptr_t page = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+  std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(data);
+  std::uintptr_t start = (begin + page - 1) / page * page;
+  std::uintptr_t end = (begin + bytes) / page * page;
+  if (end <= start) return;
+
+  const std::vector<S21NumaNode>& nodes = Nodes();
+  constexpr int kBits = 8 * sizeof(unsigned long);
+  std::vector<unsigned long> mask(nodes.back().id / kBits + 1, 0);
+  auto set = [&](int id) { mask[id / kBits] |= 1UL << (id % kBits); };
+  int mode = MPOL_INTERLEAVE;
+  if (policy == S21NumaPolicy::kInterleave) {
+    for (const S21NumaNode& node : nodes) {
+      if (node.total_bytes != 0 || nodes.size() == 1) set(node.id);
+    }
+  } else {
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return;
+    set(static_cast<int>(node));
+    mode = MPOL_PREFERRED;
+  }
+  // Ошибка (ядро без NUMA, запрет в контейнере) оставляет политику
+  // по умолчанию
+  static_cast<void>(syscall(SYS_mbind, start, end - start, mode, mask.data(),
+                            mask.size() * kBits + 1, 0));
+#else
+  static_cast<void>(data);
+  static_cast<void>(bytes);
+  static_cast<void>(policy);
+#endif
+}
+
+void S21Numa::SetPinning(bool pinned) {
+  if (S21Executor::InWorker()) {
+    throw std::logic_error("Thread pinning cannot change inside the pool");
+  }
+  g_pinned.store(pinned, std::memory_order_relaxed);
+  // Каждый поток пула перепривязывает себя сам
+  S21Executor& executor = S21Executor::Instance();
+  std::vector<std::future<void>> done;
+  for (int w = 0; w < executor.WorkerCount(); ++w) {
+    auto task = std::make_shared<std::packaged_task<void()>>(
+        [w] { PinCurrentWorker(w); });
+    done.push_back(task->get_future());
+    executor.SubmitTo(w, [task] { (*task)(); });
+  }
+  for (std::future<void>& f : done) f.get();
+}
+
+bool S21Numa::IsPinned() { return g_pinned.load(std::memory_order_relaxed); }
+
+int S21Numa::WorkerCpu(int worker) {
+  if (!IsPinned()) return -1;
+  // Первый CPU порядка остаётся вызывающему потоку, который
+  // выполняет блок 0 в S21ParallelFor
+  const std::vector<int>& order = PinOrder();
+  return order[(worker + 1) % order.size()];
+}
+
+void S21Numa::PinCurrentWorker(int worker) {
+#if defined(__linux__)
+  int cpu = WorkerCpu(worker);
+  cpu_set_t set = ProcessAffinity();
+  if (cpu >= 0) {
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+  }
+  // Ошибка (CPU пропал из cgroup) оставляет прежнюю привязку
+  static_cast<void>(sched_setaffinity(0, sizeof(set), &set));
+#else
+  static_cast<void>(worker);
+#endif
+}
+
+std::vector<long> S21Numa::Placement(const void* data, std::size_t bytes) {
+  std::vector<long> pages(Nodes().back().id + 1, 0);
+#if defined(__linux__)
+  std::uintptr_t page = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+  std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(data) / page * page;
+  std::uintptr_t end = reinterpret_cast<std::uintptr_t>(data) + bytes;
+  constexpr std::size_t kBatch = 1024;
+  std::vector<void*> addresses;
+  std::vector<int> status(kBatch);
+  for (std::uintptr_t at = begin; at < end;) {
+    addresses.clear();
+    for (; at < end && addresses.size() < kBatch; at += page) {
+      addresses.push_back(reinterpret_cast<void*>(at));
+    }
+    // Без списка узлов move_pages только сообщает, где лежат страницы
+    if (syscall(SYS_move_pages, 0, addresses.size(), addresses.data(),
+                nullptr, status.data(), 0) != 0) {
+      break;
+    }
+    for (std::size_t k = 0; k < addresses.size(); ++k) {
+      if (status[k] >= 0 && status[k] < static_cast<int>(pages.size())) {
+        ++pages[status[k]];
+      }
+    }
+  }
+#else
+  static_cast<void>(data);
+  static_cast<void>(bytes);
+#endif
+  return pages;
+}
+
+std::vector<long> S21Numa::Placement(const S21Matrix& m) {
+  const double* first = m.Row(0);
+  const double* last = m.Row(m.GetRows() - 1) + m.GetCols();
+  return Placement(first, (last - first) * sizeof(double));
+}
+
+void S21Numa::RecordAllocation(S21NumaPolicy policy, std::size_t bytes) {
+  if (!S21Telemetry::IsEnabled()) return;
+  int p = static_cast<int>(policy);
+  g_allocations[p].fetch_add(1, std::memory_order_relaxed);
+  g_bytes[p].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void S21Numa::ResetCounters() {
+  for (int p = 0; p < kPolicyCount; ++p) {
+    g_allocations[p].store(0, std::memory_order_relaxed);
+    g_bytes[p].store(0, std::memory_order_relaxed);
+  }
+}
+
+std::string S21Numa::Dump() {
+  std::ostringstream out;
+  for (int p = 0; p < kPolicyCount; ++p) {
+    std::uint64_t count = g_allocations[p].load(std::memory_order_relaxed);
+    if (count == 0) continue;
+    out << "s21_matrix_numa_allocations_total{policy=\"" << kPolicyNames[p]
+        << "\"} " << count << '\n'
+        << "s21_matrix_numa_bytes_total{policy=\"" << kPolicyNames[p]
+        << "\"} " << g_bytes[p].load(std::memory_order_relaxed) << '\n';
+  }
+  return out.str();
+}
+
+std::string S21Numa::Report() {
+  const std::vector<S21NumaNode>& nodes = Nodes();
+  std::ostringstream out;
+  out << "# numa nodes: " << nodes.size()
+      << ", policy: " << kPolicyNames[static_cast<int>(GetPolicy())]
+      << ", pinned workers: " << (IsPinned() ? "yes" : "no") << '\n'
+      << std::left << std::setw(6) << "node" << std::setw(16) << "cpus"
+      << std::right << std::setw(12) << "total_MB" << std::setw(12)
+      << "free_MB" << '\n';
+  for (const S21NumaNode& node : nodes) {
+    out << std::left << std::setw(6) << node.id << std::setw(16)
+        << FormatCpuList(node.cpus) << std::right << std::fixed
+        << std::setprecision(1) << std::setw(12) << node.total_bytes / 1048576.0
+        << std::setw(12) << node.free_bytes / 1048576.0 << '\n';
+  }
+  for (int p = 0; p < kPolicyCount; ++p) {
+    std::uint64_t count = g_allocations[p].load(std::memory_order_relaxed);
+    if (count == 0) continue;
+    out << "# " << kPolicyNames[p] << " allocations: " << count << " ("
+        << std::fixed << std::setprecision(1)
+        << g_bytes[p].load(std::memory_order_relaxed) / 1048576.0 << " MB)\n";
+  }
+  return out.str();
+}
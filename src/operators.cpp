@@ -1,9 +1,14 @@
 #include "s21_matrix_oop.h"
+#include "s21_telemetry.h"
 
 double& S21Matrix::operator()(int i, int j) {
   if (i < 0 || i >= rows_ || j < 0 || j >= cols_) {
     throw std::out_of_range("Index out of bounds");
   }
+  // Через ссылку элемент может быть изменён, поэтому общий блок
+  // отделяется, а кэш сбрасывается
+  Detach();
+  InvalidateCache();
   return matrix_[i][j];
 }
 
@@ -14,6 +19,18 @@ double S21Matrix::operator()(int i, int j) const {
   return matrix_[i][j];
 }
 
+double* S21Matrix::Row(int i) {
+  if (i < 0 || i >= rows_) throw std::out_of_range("Index out of bounds");
+  Detach();
+  InvalidateCache();
+  return matrix_[i];
+}
+
+const double* S21Matrix::Row(int i) const {
+  if (i < 0 || i >= rows_) throw std::out_of_range("Index out of bounds");
+  return matrix_[i];
+}
+
 S21Matrix S21Matrix::operator+(const S21Matrix& other) const {
   S21Matrix result(*this);
   result.SumMatrix(other);
@@ -36,8 +53,11 @@ S21Matrix S21Matrix::operator*(const double num) const {
 }
 
 S21Matrix S21Matrix::operator*(const S21Matrix& other) const {
-  S21Matrix result(*this);
-  result.MulMatrix(other);
+  if (cols_ != other.rows_) {
+    throw std::logic_error("Cols must be equal rows other matrix");
+  }
+  S21Matrix result(rows_, other.cols_);
+  result.Gemm(1.0, *this, other, 0.0);
 
   return result;
 }
@@ -47,23 +67,15 @@ bool S21Matrix::operator==(const S21Matrix& other) const {
 }
 
 S21Matrix& S21Matrix::operator=(const S21Matrix& other) {
+  S21_TELEMETRY_SCOPE(S21Op::kAssign, 1LL * other.rows_ * other.cols_);
   if (this == &other) return *this;
 
+  if (data_ == other.data_) return *this;  // блок уже общий
+
   FreeMatrix();
   rows_ = other.rows_;
   cols_ = other.cols_;
-  S21Matrix T(rows_, cols_);
-
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      T.matrix_[i][j] = other.matrix_[i][j];
-    }
-  }
-  matrix_ = T.matrix_;
-
-  T.matrix_ = nullptr;
-  T.rows_ = 0;
-  T.cols_ = 0;
+  ShareStorage(other);
   /* Альтернативный вариант
   S21Matrix temp(other); // Используем конструктор копирования
   Просто меняем местами содержимое текущего объекта и временного
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "s21_executor.h"
+#include "s21_numa.h"
+#include "s21_parallel.h"
+#include "s21_perf.h"
+
+namespace {
+
+// Общее состояние одного вызова S21ParallelFor. Участник i сначала
+// берёт блок i, затем свободные чужие, поэтому вызывающий поток может
+// выполнить их все сам, а задачи пула, запущенные позже, просто ничего
+// не найдут. Без перехвата блок i всегда достаётся одному участнику
+struct ForState {
+  explicit ForState(int blocks) : claimed(new std::atomic<bool>[blocks]) {
+    for (int b = 0; b < blocks; ++b) claimed[b] = false;
+  }
+  std::unique_ptr<std::atomic<bool>[]> claimed;
+  std::atomic<int> done{0};
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::exception_ptr error;
+  S21PerfSample helped;  // счётчики рабочих потоков за их блоки
+};
+
+}  // namespace
+
+int S21ThreadCount() {
+  static const int count = [] {
+    const char* env = std::getenv("S21_NUM_THREADS");
+    int value = env != nullptr ? std::atoi(env) : 0;
+    if (value < 1) {
+      value = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    return std::max(1, value);
+  }();
+  return count;
+}
+
+void S21ParallelFor(int begin, int end, int grain,
+                    const std::function<void(int, int)>& body) {
+  int length = end - begin;
+  if (length <= 0) return;
+  grain = std::max(grain, 1);
+  int blocks = std::min(S21ThreadCount(), (length + grain - 1) / grain);
+  if (blocks <= 1) {
+    body(begin, end);
+    return;
+  }
+
+  int step = (length + blocks - 1) / blocks;
+  auto state = std::make_shared<ForState>(blocks);
+  const std::function<void(int, int)>* fn = &body;
+  // Блоки вызывающего потока попадают в его собственные счётчики
+  bool perf = S21Perf::IsEnabled();
+  auto run = [state, fn, begin, end, step, blocks, perf](int self) {
+    bool helper = perf && self != 0;
+    for (int k = 0; k < blocks; ++k) {
+      int b = (self + k) % blocks;
+      if (state->claimed[b].exchange(true)) continue;
+      S21PerfSample start, finish;
+      if (helper) S21Perf::Read(start);
+      try {
+        int from = begin + b * step;
+        (*fn)(from, std::min(end, from + step));
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->error) state->error = std::current_exception();
+      }
+      if (helper) {
+        S21Perf::Read(finish);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        S21Perf::Accumulate(start, finish, state->helped);
+      }
+      if (state->done.fetch_add(1) + 1 == blocks) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->cv.notify_all();
+      }
+    }
+  };
+
+  // При закреплённых потоках участник i — всегда рабочий поток i - 1,
+  // и блоки строк каждый раз выполняются на одних и тех же ядрах
+  S21Executor& executor = S21Executor::Instance();
+  int helpers = std::min(blocks - 1, executor.WorkerCount());
+  bool pinned = S21Numa::IsPinned();
+  for (int i = 1; i <= helpers; ++i) {
+    auto task = [run, i] { run(i); };
+    if (pinned) {
+      executor.SubmitTo(i - 1, task);
+    } else {
+      executor.Submit(task);
+    }
+  }
+  run(0);
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->cv.wait(lock, [&] { return state->done.load() == blocks; });
+  if (perf) S21Perf::AddHelperWork(state->helped);
+  if (state->error) std::rethrow_exception(state->error);
+}
@@ -0,0 +1,320 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include "s21_parallel.h"
+#include "s21_perf.h"
+#include "s21_telemetry.h"
+
+#if defined(S21_MATRIX_PERF) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr double kDefaultFlopsPerCycle = 16.0;
+
+struct Aggregate {
+  std::uint64_t calls = 0, counted_calls = 0, total_ns = 0, flops = 0,
+                bytes = 0, own_cycles = 0;
+  std::uint64_t counters[kS21PerfEventCount] = {};
+};
+
+// Работа рабочих потоков над блоками этого потока
+thread_local S21PerfSample t_helper_work;
+
+// Ключ: операция и размерная корзина. Снятие счётчиков само стоит
+// системных вызовов, поэтому общий мьютекс здесь не заметен
+struct Store {
+  std::mutex mutex;
+  std::map<std::pair<int, int>, Aggregate> stats;
+};
+
+Store& GetStore() {
+  static Store* store = new Store();  // живёт до конца процесса
+  return *store;
+}
+
+bool EnvEnabled() {
+  const char* value = std::getenv("S21_MATRIX_PERF");
+  return value != nullptr && *value != '\0' && std::strcmp(value, "0") != 0;
+}
+
+std::atomic<bool> g_enabled{S21Perf::kCompiled && EnvEnabled()};
+std::atomic<bool> g_available[kS21PerfEventCount];
+
+int SizeBucket(std::uint64_t elements) {
+  int bucket = 0;
+  while (elements > 1) {
+    elements >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+#if defined(S21_MATRIX_PERF) && defined(__linux__)
+
+struct EventSpec {
+  std::uint32_t type;
+  std::uint64_t config;
+};
+
+constexpr std::uint64_t CacheMiss(std::uint64_t cache) {
+  return cache | PERF_COUNT_HW_CACHE_OP_READ << 8 |
+         PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+}
+
+const EventSpec kEvents[kS21PerfEventCount] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, CacheMiss(PERF_COUNT_HW_CACHE_L1D)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HW_CACHE, CacheMiss(PERF_COUNT_HW_CACHE_DTLB)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+};
+
+// Счётчики потока одной группой: все читаются одним read().
+// Событие, которое ядро не поддерживает, просто не входит в группу
+class ThreadEvents {
+ public:
+  ThreadEvents() {
+    for (int e = 0; e < kS21PerfEventCount; ++e) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = kEvents[e].type;
+      attr.config = kEvents[e].config;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+      int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1,
+                                        leader_, PERF_FLAG_FD_CLOEXEC));
+      if (fd < 0) continue;
+      if (leader_ < 0) leader_ = fd;
+      fds_[slots_] = fd;
+      events_[slots_++] = e;
+      g_available[e].store(true, std::memory_order_relaxed);
+    }
+  }
+
+  ~ThreadEvents() {
+    for (int k = 0; k < slots_; ++k) close(fds_[k]);
+  }
+
+  bool Read(S21PerfSample& sample) const {
+    if (leader_ < 0) return false;
+    std::uint64_t buffer[3 + kS21PerfEventCount];
+    ssize_t size = read(leader_, buffer, sizeof(buffer));
+    if (size < static_cast<ssize_t>(sizeof(std::uint64_t) * (3 + slots_))) {
+      return false;
+    }
+    sample.time_enabled = buffer[1];
+    sample.time_running = buffer[2];
+    for (int k = 0; k < slots_; ++k) sample.values[events_[k]] = buffer[3 + k];
+    return true;
+  }
+
+ private:
+  int leader_ = -1;
+  int slots_ = 0;
+  int fds_[kS21PerfEventCount] = {};
+  int events_[kS21PerfEventCount] = {};
+};
+
+#endif
+
+// Печатает значение или прочерк, если метрика недоступна
+void Cell(std::ostream& out, bool ok, double value, int width,
+          int precision) {
+  if (ok) {
+    out << std::setw(width) << std::fixed << std::setprecision(precision)
+        << value;
+  } else {
+    out << std::setw(width) << '-';
+  }
+}
+
+}  // namespace
+
+void S21Perf::SetEnabled(bool enabled) {
+  g_enabled.store(enabled && kCompiled, std::memory_order_relaxed);
+}
+
+bool S21Perf::IsEnabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+bool S21Perf::IsAvailable(S21PerfEvent event) {
+  return g_available[static_cast<int>(event)].load(std::memory_order_relaxed);
+}
+
+void S21Perf::Reset() {
+  Store& store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  store.stats.clear();
+}
+
+void S21Perf::Read(S21PerfSample& sample) {
+#if defined(S21_MATRIX_PERF) && defined(__linux__)
+  thread_local ThreadEvents events;
+  sample.valid = events.Read(sample);
+  if (!sample.valid) return;
+  for (int e = 0; e < kS21PerfEventCount; ++e) {
+    sample.values[e] += t_helper_work.values[e];
+  }
+  sample.helper_cycles =
+      t_helper_work.values[static_cast<int>(S21PerfEvent::kCycles)];
+#else
+  sample.valid = false;
+#endif
+}
+
+void S21Perf::Accumulate(const S21PerfSample& start, const S21PerfSample& end,
+                         S21PerfSample& total) {
+  if (!start.valid || !end.valid || end.time_running <= start.time_running) {
+    return;
+  }
+  double scale = static_cast<double>(end.time_enabled - start.time_enabled) /
+                 static_cast<double>(end.time_running - start.time_running);
+  for (int e = 0; e < kS21PerfEventCount; ++e) {
+    total.values[e] += static_cast<std::uint64_t>(
+        static_cast<double>(end.values[e] - start.values[e]) * scale);
+  }
+  total.valid = true;
+}
+
+void S21Perf::AddHelperWork(const S21PerfSample& total) {
+  if (!total.valid) return;
+  for (int e = 0; e < kS21PerfEventCount; ++e) {
+    t_helper_work.values[e] += total.values[e];
+  }
+}
+
+void S21Perf::Record(S21Op op, std::uint64_t ns, std::uint64_t elements,
+                     std::uint64_t flops, std::uint64_t bytes,
+                     const S21PerfSample& start, const S21PerfSample& end) {
+  Store& store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  Aggregate& a = store.stats[{static_cast<int>(op), SizeBucket(elements)}];
+  ++a.calls;
+  a.total_ns += ns;
+  a.flops += flops;
+  a.bytes += bytes;
+  if (start.valid && end.valid && end.time_running > start.time_running) {
+    // При мультиплексировании группа считала не всё время: масштабируем
+    double scale = static_cast<double>(end.time_enabled - start.time_enabled) /
+                   static_cast<double>(end.time_running - start.time_running);
+    for (int e = 0; e < kS21PerfEventCount; ++e) {
+      a.counters[e] += static_cast<std::uint64_t>(
+          static_cast<double>(end.values[e] - start.values[e]) * scale);
+    }
+    int cycles = static_cast<int>(S21PerfEvent::kCycles);
+    a.own_cycles += static_cast<std::uint64_t>(
+        static_cast<double>((end.values[cycles] - end.helper_cycles) -
+                            (start.values[cycles] - start.helper_cycles)) *
+        scale);
+    ++a.counted_calls;
+  }
+}
+
+std::vector<S21PerfStats> S21Perf::Snapshot() {
+  Store& store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  std::vector<S21PerfStats> result;
+  for (const auto& [key, a] : store.stats) {
+    S21PerfStats s{};
+    s.name = S21Telemetry::OpName(static_cast<S21Op>(key.first));
+    s.size_bucket = key.second;
+    s.calls = a.calls;
+    s.counted_calls = a.counted_calls;
+    s.total_ns = a.total_ns;
+    s.flops = a.flops;
+    s.bytes = a.bytes;
+    s.own_cycles = a.own_cycles;
+    std::copy(a.counters, a.counters + kS21PerfEventCount, s.counters);
+    result.push_back(s);
+  }
+  return result;
+}
+
+std::string S21Perf::Report(double peak_gflops) {
+  std::vector<S21PerfStats> stats = Snapshot();
+  auto counter = [](const S21PerfStats& s, S21PerfEvent e) {
+    return static_cast<double>(s.counters[static_cast<int>(e)]);
+  };
+
+  // Частота по тактам вызывающего потока в вызовах, где счётчики
+  // работали всё время; флопы считаются по всем участникам, поэтому
+  // пик — на все S21ThreadCount() потоков
+  double cycles = 0.0, ns = 0.0;
+  for (const S21PerfStats& s : stats) {
+    if (s.counted_calls != s.calls) continue;
+    cycles += static_cast<double>(s.own_cycles);
+    ns += static_cast<double>(s.total_ns);
+  }
+  std::string peak_source = "given";
+  if (peak_gflops <= 0.0) {
+    peak_gflops = ns > 0.0 ? cycles / ns * kDefaultFlopsPerCycle *
+                                 S21ThreadCount()
+                           : 0.0;
+    peak_source = "estimated, " + std::to_string(S21ThreadCount()) +
+                  " threads";
+  }
+
+  std::ostringstream out;
+  if (peak_gflops > 0.0) {
+    out << "# peak GFLOP/s: " << std::fixed << std::setprecision(1)
+        << peak_gflops << " (" << peak_source << ")\n";
+  } else {
+    out << "# peak GFLOP/s: unknown\n";
+  }
+  if (!IsAvailable(S21PerfEvent::kCycles) &&
+      !IsAvailable(S21PerfEvent::kInstructions)) {
+    out << "# hardware counters unavailable: timing only\n";
+  }
+  out << std::left << std::setw(16) << "op" << std::right << std::setw(6)
+      << "size" << std::setw(9) << "calls" << std::setw(11) << "time_ms"
+      << std::setw(9) << "GFLOP/s" << std::setw(7) << "%peak" << std::setw(6)
+      << "IPC" << std::setw(8) << "B/flop" << std::setw(9) << "L1_MPKI"
+      << std::setw(9) << "LLC_MPKI" << std::setw(10) << "dTLB_MPKI"
+      << std::setw(9) << "br_MPKI" << '\n';
+
+  for (const S21PerfStats& s : stats) {
+    double time = static_cast<double>(s.total_ns);
+    double flops = static_cast<double>(s.flops);
+    double instructions = counter(s, S21PerfEvent::kInstructions);
+    double gflops = time > 0.0 ? flops / time : 0.0;
+    bool counted = s.counted_calls > 0;
+    bool has_instr = counted && instructions > 0.0;
+    auto mpki = [&](S21PerfEvent e) {
+      return 1000.0 * counter(s, e) / instructions;
+    };
+
+    out << std::left << std::setw(16) << s.name << std::right << std::setw(6)
+        << ("2^" + std::to_string(s.size_bucket)) << std::setw(9) << s.calls;
+    Cell(out, true, time / 1e6, 11, 3);
+    Cell(out, flops > 0.0 && time > 0.0, gflops, 9, 2);
+    Cell(out, flops > 0.0 && peak_gflops > 0.0, 100.0 * gflops / peak_gflops,
+         7, 1);
+    Cell(out, has_instr && counter(s, S21PerfEvent::kCycles) > 0.0,
+         instructions / counter(s, S21PerfEvent::kCycles), 6, 2);
+    Cell(out, flops > 0.0 && s.bytes > 0,
+         static_cast<double>(s.bytes) / flops, 8, 2);
+    Cell(out, has_instr && IsAvailable(S21PerfEvent::kL1dMisses),
+         mpki(S21PerfEvent::kL1dMisses), 9, 2);
+    Cell(out, has_instr && IsAvailable(S21PerfEvent::kLlcMisses),
+         mpki(S21PerfEvent::kLlcMisses), 9, 2);
+    Cell(out, has_instr && IsAvailable(S21PerfEvent::kDtlbMisses),
+         mpki(S21PerfEvent::kDtlbMisses), 10, 2);
+    Cell(out, has_instr && IsAvailable(S21PerfEvent::kBranchMisses),
+         mpki(S21PerfEvent::kBranchMisses), 9, 2);
+    out << '\n';
+  }
+  return out.str();
+}
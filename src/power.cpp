@@ -0,0 +1,73 @@
+#include <cmath>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+#include "s21_telemetry.h"
+
+void S21Matrix::Swap(S21Matrix& other) noexcept {
+  std::swap(rows_, other.rows_);
+  std::swap(cols_, other.cols_);
+  std::swap(stride_, other.stride_);
+  std::swap(data_, other.data_);
+  std::swap(matrix_, other.matrix_);
+  std::swap(factorization_, other.factorization_);
+}
+
+S21Matrix S21Matrix::Pow(int n, S21PowMethod method) const {
+  S21_TELEMETRY_SCOPE(S21Op::kPow, 1LL * rows_ * cols_);
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix must be square to raise to a power");
+  }
+
+  if (method == S21PowMethod::kEigen) {
+    // A^n = V diag(l^n) V^T для симметричной A
+    S21EigenResult eigen = EigenSymmetric();
+    S21Matrix scaled(eigen.vectors);
+    scaled.Detach();
+    for (int j = 0; j < cols_; ++j) {
+      double lambda = eigen.values(j);
+      if (n < 0 && lambda == 0.0) {
+        throw std::logic_error("The determinant of the matrix is 0.");
+      }
+      double factor = std::pow(lambda, n);
+      for (int i = 0; i < rows_; ++i) scaled.matrix_[i][j] *= factor;
+    }
+    S21Matrix result(rows_, cols_);
+    result.Gemm(1.0, scaled, eigen.vectors, 0.0, false, true);
+    return result;
+  }
+
+  S21Matrix result(rows_, cols_);
+  if (n == 0) {
+    for (int i = 0; i < rows_; ++i) result.matrix_[i][i] = 1.0;
+    return result;
+  }
+
+  // Возведение в квадрат с двумя рабочими буферами: на каждом шаге
+  // Gemm пишет в scratch, после чего буферы меняются местами
+  S21Matrix base = n > 0 ? S21Matrix(*this) : InverseMatrix();
+  S21Matrix scratch(rows_, cols_);
+  unsigned long long e = n > 0 ? static_cast<unsigned long long>(n)
+                               : -static_cast<long long>(n);
+  bool first = true;
+  while (e != 0) {
+    if (e & 1ULL) {
+      if (first) {
+        for (int i = 0; i < rows_; ++i) {
+          std::copy(base.matrix_[i], base.matrix_[i] + cols_,
+                    result.matrix_[i]);
+        }
+        first = false;
+      } else {
+        scratch.Gemm(1.0, result, base, 0.0);
+        result.Swap(scratch);
+      }
+    }
+    e >>= 1;
+    if (e != 0) {
+      scratch.Gemm(1.0, base, base, 0.0);
+      base.Swap(scratch);
+    }
+  }
+  return result;
+}
@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+// Минимальное число элементов матрицы на один поток
+constexpr int kParallelElements = 1 << 15;
+// Результат крупнее последнего уровня кэша пишется в обход кэша,
+// чтобы не вытеснять из него операнды
+constexpr long long kStreamingBytes = 8LL << 20;
+
+int RowGrain(int cols) { return std::max(1, kParallelElements / cols); }
+
+// out = alpha * x; при stream — невременными записями по 16 байт
+void ScaleRow(double alpha, const double* x, double* out, int n,
+              bool stream) {
+  int j = 0;
+#if defined(__SSE2__)
+  if (stream) {
+    for (; j < n && reinterpret_cast<std::uintptr_t>(out + j) % 16 != 0;
+         ++j) {
+      out[j] = alpha * x[j];
+    }
+    __m128d a = _mm_set1_pd(alpha);
+    for (; j + 2 <= n; j += 2) {
+      _mm_stream_pd(out + j, _mm_mul_pd(a, _mm_loadu_pd(x + j)));
+    }
+  }
+#else
+  static_cast<void>(stream);
+#endif
+  for (; j < n; ++j) out[j] = alpha * x[j];
+}
+
+// Невременные записи не упорядочены с обычными: барьер перед тем,
+// как результат увидят другие потоки
+void StreamFence(bool stream) {
+#if defined(__SSE2__)
+  if (stream) _mm_sfence();
+#else
+  static_cast<void>(stream);
+#endif
+}
+
+}  // namespace
+
+void S21Matrix::CheckSameSize(const S21Matrix& other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw std::logic_error(
+        "Matrix dimensions must be equal for elementwise operations");
+  }
+}
+
+void S21Matrix::HadamardProduct(const S21Matrix& other) {
+  S21_TELEMETRY_SCOPE(S21Op::kHadamard, 1LL * rows_ * cols_,
+                      24LL * rows_ * cols_, 1LL * rows_ * cols_);
+  ZipWith(other, [](double x, double y) { return x * y; });
+}
+
+void S21Matrix::HadamardDivide(const S21Matrix& other) {
+  S21_TELEMETRY_SCOPE(S21Op::kHadamard, 1LL * rows_ * cols_,
+                      24LL * rows_ * cols_, 1LL * rows_ * cols_);
+  ZipWith(other, [](double x, double y) { return x / y; });
+}
+
+S21Matrix S21Matrix::HadamardProduct(const S21Matrix& a, const S21Matrix& b) {
+  S21_TELEMETRY_SCOPE(S21Op::kHadamard, 1LL * a.rows_ * a.cols_,
+                      24LL * a.rows_ * a.cols_, 1LL * a.rows_ * a.cols_);
+  return ZipWith(a, b, [](double x, double y) { return x * y; });
+}
+
+S21Matrix S21Matrix::HadamardDivide(const S21Matrix& a, const S21Matrix& b) {
+  S21_TELEMETRY_SCOPE(S21Op::kHadamard, 1LL * a.rows_ * a.cols_,
+                      24LL * a.rows_ * a.cols_, 1LL * a.rows_ * a.cols_);
+  return ZipWith(a, b, [](double x, double y) { return x / y; });
+}
+
+S21Matrix S21Matrix::Kronecker(const S21Matrix& a, const S21Matrix& b) {
+  long long rows = 1LL * a.rows_ * b.rows_;
+  long long cols = 1LL * a.cols_ * b.cols_;
+  if (rows > INT_MAX || cols > INT_MAX) {
+    throw std::invalid_argument("Kronecker product is too large");
+  }
+  S21_TELEMETRY_SCOPE(S21Op::kKronecker, rows * cols, 8 * rows * cols,
+                      rows * cols);
+  S21Matrix result(static_cast<int>(rows), static_cast<int>(cols));
+  bool stream = 8 * rows * cols >= kStreamingBytes;
+  int p = b.rows_, q = b.cols_;
+
+  // Строка i результата — строка i / p матрицы a, где каждый элемент
+  // заменён строкой i % p матрицы b, умноженной на него
+  auto fill_rows = [&](int from, int to) {
+    for (int i = from; i < to; ++i) {
+      const double* ai = a.matrix_[i / p];
+      const double* bi = b.matrix_[i % p];
+      double* out = result.matrix_[i];
+      for (int j = 0; j < a.cols_; ++j) {
+        ScaleRow(ai[j], bi, out + 1LL * j * q, q, stream);
+      }
+    }
+    StreamFence(stream);
+  };
+  S21ParallelFor(0, result.rows_, RowGrain(result.cols_), fill_rows);
+  return result;
+}
+
+S21LinearOperator S21Matrix::KroneckerOperator(const S21Matrix& a,
+                                               const S21Matrix& b) {
+  // Копии разделяют хранение с a и b, пока те не изменятся
+  return [a, b](const S21Vector& x, S21Vector& y) {
+    int m = a.rows_, n = a.cols_, p = b.rows_, q = b.cols_;
+    if (1LL * x.GetSize() != 1LL * n * q || 1LL * y.GetSize() != 1LL * m * p) {
+      throw std::logic_error("Vector size does not match matrix dimensions");
+    }
+    S21Matrix X(n, q);
+    for (int j = 0; j < n; ++j) {
+      std::copy(x.Data() + 1LL * j * q, x.Data() + 1LL * (j + 1) * q,
+                X.matrix_[j]);
+    }
+
+    // (A ⊗ B) vec(X) = vec(A X B^T); порядок умножений — более дешёвый
+    S21Matrix Y(m, p);
+    if (1LL * n * p * (q + m) <= 1LL * m * q * (n + p)) {
+      S21Matrix Z(n, p);
+      Z.Gemm(1.0, X, b, 0.0, false, true);
+      Y.Gemm(1.0, a, Z, 0.0);
+    } else {
+      S21Matrix Z(m, q);
+      Z.Gemm(1.0, a, X, 0.0);
+      Y.Gemm(1.0, Z, b, 0.0, false, true);
+    }
+    for (int i = 0; i < m; ++i) {
+      std::copy(Y.matrix_[i], Y.matrix_[i] + p, y.Data() + 1LL * i * p);
+    }
+  };
+}
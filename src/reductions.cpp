@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+// Минимальное число элементов матрицы на один блок
+constexpr int kParallelElements = 1 << 15;
+// Верхняя граница числа блоков: частичные результаты хранятся по
+// блокам, а не по потокам, поэтому итог не зависит от S21_NUM_THREADS
+constexpr int kMaxChunks = 64;
+// Отрезок попарного суммирования, складываемый напрямую
+constexpr int kPairwiseBase = 32;
+
+// Разбиение строк на фиксированные блоки
+struct Chunks {
+  int rows_per_chunk;
+  int count;
+};
+
+Chunks SplitRows(int rows, int cols, int min_rows = 1) {
+  int per = std::max(kParallelElements / std::max(cols, 1), min_rows);
+  per = std::max({per, (rows + kMaxChunks - 1) / kMaxChunks, 1});
+  return {per, (rows + per - 1) / per};
+}
+
+// Максимум, сохраняющий nan: std::max(acc, nan) вернул бы acc
+inline double MaxOrNan(double acc, double x) {
+  return acc >= x || acc != acc ? acc : x;
+}
+
+// Блоки считаются параллельно, каждый пишет свой частичный результат
+template <class Body>
+void ForEachChunk(const Chunks& chunks, int rows, Body body) {
+  S21ParallelFor(0, chunks.count, 1, [&](int from, int to) {
+    for (int c = from; c < to; ++c) {
+      int begin = c * chunks.rows_per_chunk;
+      body(c, begin, std::min(rows, begin + chunks.rows_per_chunk));
+    }
+  });
+}
+
+// Четыре независимые суммы разрывают цепочку зависимостей сложений
+// и дают компилятору векторизовать цикл без переупорядочивания
+template <class F>
+double PlainSum(const double* x, int n, F f) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    s0 += f(x[j]);
+    s1 += f(x[j + 1]);
+    s2 += f(x[j + 2]);
+    s3 += f(x[j + 3]);
+  }
+  for (; j < n; ++j) s0 += f(x[j]);
+  return (s0 + s1) + (s2 + s3);
+}
+
+template <class F>
+double PairwiseSum(const double* x, int n, F f) {
+  if (n <= kPairwiseBase) return PlainSum(x, n, f);
+  int half = n / 2;
+  return PairwiseSum(x, half, f) + PairwiseSum(x + half, n - half, f);
+}
+
+// Сумма Кэхэна-Бабушки (Ноймайера): поправка верна и тогда, когда
+// слагаемое больше накопленной суммы
+struct Compensated {
+  double sum = 0.0, correction = 0.0;
+
+  void Add(double x) {
+    double t = sum + x;
+    correction += std::fabs(sum) >= std::fabs(x) ? (sum - t) + x
+                                                 : (x - t) + sum;
+    sum = t;
+  }
+  double Value() const { return sum + correction; }
+};
+
+template <class F>
+double SumRows(double** m, int rows, int cols, S21Summation mode, F f) {
+  Chunks chunks = SplitRows(rows, cols);
+  std::vector<double> partial(chunks.count, 0.0);
+  auto identity = [](double x) { return x; };
+
+  ForEachChunk(chunks, rows, [&](int c, int begin, int end) {
+    if (mode == S21Summation::kKahan) {
+      Compensated acc;
+      for (int i = begin; i < end; ++i) {
+        for (int j = 0; j < cols; ++j) acc.Add(f(m[i][j]));
+      }
+      partial[c] = acc.Value();
+    } else if (mode == S21Summation::kPairwise) {
+      std::vector<double> row_sums(end - begin);
+      for (int i = begin; i < end; ++i) {
+        row_sums[i - begin] = PairwiseSum(m[i], cols, f);
+      }
+      partial[c] = PairwiseSum(row_sums.data(), end - begin, identity);
+    } else {
+      double s = 0.0;
+      for (int i = begin; i < end; ++i) s += PlainSum(m[i], cols, f);
+      partial[c] = s;
+    }
+  });
+
+  if (mode == S21Summation::kKahan) {
+    Compensated acc;
+    for (double p : partial) acc.Add(p);
+    return acc.Value();
+  }
+  if (mode == S21Summation::kPairwise) {
+    return PairwiseSum(partial.data(), chunks.count, identity);
+  }
+  double s = 0.0;
+  for (double p : partial) s += p;
+  return s;
+}
+
+// Первое вхождение наилучшего элемента; nan пропускаются, если в
+// матрице есть хоть одно число
+template <class Better>
+S21Extremum FindExtremum(double** m, int rows, int cols, Better better) {
+  S21Extremum none{std::numeric_limits<double>::quiet_NaN(), -1, -1};
+  if (rows == 0 || cols == 0) return none;
+  Chunks chunks = SplitRows(rows, cols);
+  std::vector<S21Extremum> partial(chunks.count, none);
+
+  ForEachChunk(chunks, rows, [&](int c, int begin, int end) {
+    S21Extremum best = none;
+    for (int i = begin; i < end; ++i) {
+      const double* row = m[i];
+      for (int j = 0; j < cols; ++j) {
+        if (std::isnan(row[j])) continue;
+        if (best.row < 0 || better(row[j], best.value)) best = {row[j], i, j};
+      }
+    }
+    partial[c] = best;
+  });
+
+  S21Extremum best = none;
+  for (const S21Extremum& p : partial) {
+    if (p.row >= 0 && (best.row < 0 || better(p.value, best.value))) best = p;
+  }
+  if (best.row < 0) best = {m[0][0], 0, 0};
+  return best;
+}
+
+}  // namespace
+
+double S21Matrix::Trace() const {
+  S21_TELEMETRY_SCOPE(S21Op::kReduce, rows_, 8LL * rows_, rows_);
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix must be square to calculate trace");
+  }
+  double trace = 0.0;
+  for (int i = 0; i < rows_; ++i) trace += matrix_[i][i];
+  return trace;
+}
+
+double S21Matrix::Sum(S21Summation mode) const {
+  S21_TELEMETRY_SCOPE(S21Op::kReduce, 1LL * rows_ * cols_,
+                      8LL * rows_ * cols_, 1LL * rows_ * cols_);
+  return SumRows(matrix_, rows_, cols_, mode, [](double x) { return x; });
+}
+
+double S21Matrix::FrobeniusNorm(S21Summation mode) const {
+  S21_TELEMETRY_SCOPE(S21Op::kReduce, 1LL * rows_ * cols_,
+                      8LL * rows_ * cols_, 2LL * rows_ * cols_);
+  double sum =
+      SumRows(matrix_, rows_, cols_, mode, [](double x) { return x * x; });
+  if (std::isfinite(sum) && sum >= DBL_MIN) return std::sqrt(sum);
+
+  // Переполнение или потеря значимости квадратов: второй проход
+  // с масштабированием на наибольший модуль, как в dnrm2
+  double scale = MaxAbs();
+  if (scale == 0.0 || !std::isfinite(scale)) return std::sqrt(sum);
+  double inv = 1.0 / scale;
+  double scaled = SumRows(matrix_, rows_, cols_, mode, [inv](double x) {
+    double y = x * inv;
+    return y * y;
+  });
+  return scale * std::sqrt(scaled);
+}
+
+double S21Matrix::Norm1() const {
+  S21_TELEMETRY_SCOPE(S21Op::kReduce, 1LL * rows_ * cols_,
+                      8LL * rows_ * cols_, 1LL * rows_ * cols_);
+  // Не меньше 8 строк на блок: суммы по столбцам всех блоков
+  // занимают не больше восьмой части матрицы
+  Chunks chunks = SplitRows(rows_, cols_, 8);
+  std::vector<double> sums(1LL * chunks.count * cols_, 0.0);
+  ForEachChunk(chunks, rows_, [&](int c, int begin, int end) {
+    double* out = sums.data() + 1LL * c * cols_;
+    for (int i = begin; i < end; ++i) {
+      const double* row = matrix_[i];
+      for (int j = 0; j < cols_; ++j) out[j] += std::fabs(row[j]);
+    }
+  });
+  for (int c = 1; c < chunks.count; ++c) {
+    const double* part = sums.data() + 1LL * c * cols_;
+    for (int j = 0; j < cols_; ++j) sums[j] += part[j];
+  }
+  double norm = 0.0;
+  for (int j = 0; j < cols_; ++j) norm = MaxOrNan(norm, sums[j]);
+  return norm;
+}
+
+double S21Matrix::NormInf() const {
+  S21_TELEMETRY_SCOPE(S21Op::kReduce, 1LL * rows_ * cols_,
+                      8LL * rows_ * cols_, 1LL * rows_ * cols_);
+  Chunks chunks = SplitRows(rows_, cols_);
+  std::vector<double> partial(chunks.count, 0.0);
+  ForEachChunk(chunks, rows_, [&](int c, int begin, int end) {
+    double norm = 0.0;
+    for (int i = begin; i < end; ++i) {
+      norm = MaxOrNan(norm, PlainSum(matrix_[i], cols_,
+                                     [](double x) { return std::fabs(x); }));
+    }
+    partial[c] = norm;
+  });
+  double norm = 0.0;
+  for (double p : partial) norm = MaxOrNan(norm, p);
+  return norm;
+}
+
+double S21Matrix::MaxAbs() const {
+  S21_TELEMETRY_SCOPE(S21Op::kReduce, 1LL * rows_ * cols_,
+                      8LL * rows_ * cols_, 1LL * rows_ * cols_);
+  Chunks chunks = SplitRows(rows_, cols_);
+  std::vector<double> partial(chunks.count, 0.0);
+  ForEachChunk(chunks, rows_, [&](int c, int begin, int end) {
+    // std::max векторизуется, а nan отмечается отдельным флагом
+    double m0 = 0.0, m1 = 0.0;
+    int nan = 0;
+    for (int i = begin; i < end; ++i) {
+      const double* row = matrix_[i];
+      int j = 0;
+      for (; j + 2 <= cols_; j += 2) {
+        m0 = std::max(m0, std::fabs(row[j]));
+        m1 = std::max(m1, std::fabs(row[j + 1]));
+        nan |= (row[j] != row[j]) | (row[j + 1] != row[j + 1]);
+      }
+      if (j < cols_) {
+        m0 = std::max(m0, std::fabs(row[j]));
+        nan |= row[j] != row[j];
+      }
+    }
+    partial[c] =
+        nan ? std::numeric_limits<double>::quiet_NaN() : std::max(m0, m1);
+  });
+  double result = 0.0;
+  for (double p : partial) result = MaxOrNan(result, p);
+  return result;
+}
+
+S21Extremum S21Matrix::ArgMin() const {
+  S21_TELEMETRY_SCOPE(S21Op::kReduce, 1LL * rows_ * cols_,
+                      8LL * rows_ * cols_);
+  return FindExtremum(matrix_, rows_, cols_,
+                      [](double x, double best) { return x < best; });
+}
+
+S21Extremum S21Matrix::ArgMax() const {
+  S21_TELEMETRY_SCOPE(S21Op::kReduce, 1LL * rows_ * cols_,
+                      8LL * rows_ * cols_);
+  return FindExtremum(matrix_, rows_, cols_,
+                      [](double x, double best) { return x > best; });
+}
@@ -0,0 +1,93 @@
+#ifndef S21_DISTRIBUTED_H
+#define S21_DISTRIBUTED_H
+
+#include <mpi.h>
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Распределённые матрицы поверх MPI (сборка с S21_MATRIX_MPI).
+// Процессы образуют решётку P x Q, матрица делится на блоки
+// block x block, которые раздаются по решётке циклически, как в
+// ScaLAPACK: блок (I, J) хранит процесс (I mod P, J mod Q). Все
+// функции коллективны: их вызывают все процессы решётки
+
+class S21ProcessGrid {
+ public:
+  // Решётка, близкая к квадратной (MPI_Dims_create)
+  explicit S21ProcessGrid(MPI_Comm comm = MPI_COMM_WORLD);
+  S21ProcessGrid(MPI_Comm comm, int rows, int cols);
+  S21ProcessGrid(const S21ProcessGrid&) = delete;
+  S21ProcessGrid& operator=(const S21ProcessGrid&) = delete;
+  ~S21ProcessGrid();
+
+  int Rank() const { return rank_; }
+  int Size() const { return rows_ * cols_; }
+  int GetRows() const { return rows_; }
+  int GetCols() const { return cols_; }
+  int MyRow() const { return my_row_; }
+  int MyCol() const { return my_col_; }
+  // Копия исходного коммуникатора и его срезы по строкам и столбцам
+  // решётки; номер процесса в RowComm равен MyCol, в ColComm — MyRow
+  MPI_Comm Comm() const { return comm_; }
+  MPI_Comm RowComm() const { return row_comm_; }
+  MPI_Comm ColComm() const { return col_comm_; }
+
+ private:
+  void Init(MPI_Comm comm, int rows, int cols);
+
+  int rank_, rows_, cols_, my_row_, my_col_;
+  MPI_Comm comm_, row_comm_, col_comm_;
+};
+
+struct S21DistributedLU;
+
+class S21DistributedMatrix {
+ public:
+  // Каждому процессу должен достаться хотя бы один блок по каждому
+  // измерению; решётка должна жить дольше матрицы
+  S21DistributedMatrix(const S21ProcessGrid& grid, int rows, int cols,
+                       int block = 64);
+
+  int GetRows() const { return rows_; }
+  int GetCols() const { return cols_; }
+  int BlockSize() const { return block_; }
+  const S21ProcessGrid& Grid() const { return *grid_; }
+  // Блоки процесса, уложенные подряд в порядке глобальных индексов
+  S21Matrix& Local() { return local_; }
+  const S21Matrix& Local() const { return local_; }
+  int GlobalRow(int local_row) const;
+  int GlobalCol(int local_col) const;
+
+  // Раздаёт матрицу процесса root; на остальных процессах m не читается
+  static S21DistributedMatrix Scatter(const S21ProcessGrid& grid,
+                                      const S21Matrix& m, int rows, int cols,
+                                      int block = 64, int root = 0);
+  // Собирает матрицу на root; остальные процессы получают 1 x 1
+  S21Matrix Gather(int root = 0) const;
+
+  // C = A * B по алгоритму SUMMA: на шаге k панель столбцов A
+  // рассылается по строкам решётки, панель строк B — по столбцам, и
+  // рассылка панели k + 1 идёт, пока считается локальный Gemm шага k
+  static S21DistributedMatrix Multiply(const S21DistributedMatrix& a,
+                                       const S21DistributedMatrix& b);
+  // LU с выбором ведущего элемента по столбцу, блочный правосторонний
+  S21DistributedLU LU() const;
+
+ private:
+  const S21ProcessGrid* grid_;
+  int rows_, cols_, block_;
+  S21Matrix local_;
+};
+
+struct S21DistributedLU {
+  // L (без единичной диагонали) и U на месте, как в getrf
+  S21DistributedMatrix factors;
+  // Строка i переставлена со строкой pivots[i], одинаково на всех
+  std::vector<int> pivots;
+  double determinant;
+  bool singular;
+};
+
+#endif
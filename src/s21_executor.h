@@ -0,0 +1,56 @@
+#ifndef S21_EXECUTOR_H
+#define S21_EXECUTOR_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Общий пул потоков библиотеки: асинхронные операции, граф задач
+// и S21ParallelFor выполняются на одних и тех же рабочих потоках
+class S21Executor {
+ public:
+  static S21Executor& Instance();
+
+  S21Executor(const S21Executor&) = delete;
+  S21Executor& operator=(const S21Executor&) = delete;
+  ~S21Executor();
+
+  void Submit(std::function<void()> task);
+  // Задача для конкретного рабочего потока; он берёт свою очередь
+  // раньше общей
+  void SubmitTo(int worker, std::function<void()> task);
+  int WorkerCount() const { return static_cast<int>(workers_.size()); }
+  // true, если вызывающий код выполняется на рабочем потоке пула
+  static bool InWorker();
+  // Номер рабочего потока или -1 вне пула
+  static int WorkerIndex();
+
+  template <class F>
+  std::future<std::invoke_result_t<F>> Async(F&& f) {
+    using Result = std::invoke_result_t<F>;
+    auto task =
+        std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+    std::future<Result> future = task->get_future();
+    Submit([task]() { (*task)(); });
+    return future;
+  }
+
+ private:
+  explicit S21Executor(int workers);
+  void WorkerLoop(int index);
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> queue_;
+  std::vector<std::deque<std::function<void()>>> own_queues_;
+  std::vector<std::thread> workers_;
+  bool stop_;
+};
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef S21_IO_H
+#define S21_IO_H
+
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Обмен данными с NumPy (.npy, .npz) и с внешними буферами.
+// Копирование идёт целыми строками; float64 в порядке C читается
+// и пишется прямо в память матрицы без промежуточного буфера
+
+enum class S21DType { kFloat32, kFloat64 };
+enum class S21Layout { kRowMajor, kColumnMajor };
+
+// Сплошной буфер rows * cols без отступов между строками/столбцами
+S21Matrix S21FromBuffer(const double* data, int rows, int cols,
+                        S21Layout layout = S21Layout::kRowMajor);
+S21Matrix S21FromBuffer(const float* data, int rows, int cols,
+                        S21Layout layout = S21Layout::kRowMajor);
+void S21ToBuffer(const S21Matrix& m, double* out,
+                 S21Layout layout = S21Layout::kRowMajor);
+void S21ToBuffer(const S21Matrix& m, float* out,
+                 S21Layout layout = S21Layout::kRowMajor);
+
+// .npy версий 1.0-3.0: '<f8', '>f8', '<f4', '>f4', порядок C и Fortran,
+// одномерный массив формы (n,) читается как столбец n x 1
+S21Matrix S21ReadNpy(std::istream& in);
+void S21WriteNpy(std::ostream& out, const S21Matrix& m,
+                 S21DType type = S21DType::kFloat64,
+                 S21Layout layout = S21Layout::kRowMajor);
+S21Matrix S21LoadNpy(const std::string& path);
+void S21SaveNpy(const std::string& path, const S21Matrix& m,
+                S21DType type = S21DType::kFloat64,
+                S21Layout layout = S21Layout::kRowMajor);
+
+// Архив .npz (np.savez): массивы читаются по одному по запросу.
+// Поддерживаются только несжатые записи (ZIP_STORED), в том числе ZIP64
+class S21NpzReader {
+ public:
+  explicit S21NpzReader(const std::string& path);
+
+  // Имена массивов без расширения .npy
+  const std::vector<std::string>& Names() const { return names_; }
+  bool Contains(const std::string& name) const;
+  S21Matrix Load(const std::string& name);
+
+ private:
+  struct Entry {
+    std::uint16_t method;
+    std::uint32_t crc;
+    std::uint64_t size;
+    std::uint64_t offset;
+  };
+
+  std::ifstream in_;
+  std::vector<std::string> names_;
+  std::vector<Entry> entries_;
+};
+
+// Пишет массивы в архив по мере добавления, не держа их в памяти
+class S21NpzWriter {
+ public:
+  explicit S21NpzWriter(const std::string& path);
+  S21NpzWriter(const S21NpzWriter&) = delete;
+  S21NpzWriter& operator=(const S21NpzWriter&) = delete;
+  ~S21NpzWriter();
+
+  void Add(const std::string& name, const S21Matrix& m,
+           S21DType type = S21DType::kFloat64);
+  // Дописывает центральный каталог; после вызова Add недоступен
+  void Close();
+
+ private:
+  struct Entry {
+    std::string name;
+    std::uint32_t crc;
+    std::uint64_t size;
+    std::uint64_t offset;
+  };
+
+  std::ofstream out_;
+  std::vector<Entry> entries_;
+  bool closed_ = false;
+};
+
+#endif
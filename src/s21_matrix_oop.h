@@ -1,38 +1,287 @@
 #ifndef S21_MATRIX_OOP_H
 #define S21_MATRIX_OOP_H
 
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <stdexcept>
+#include <string>
+#include <vector>
+
+// Представления std::mdspan включаются опцией S21_MATRIX_MDSPAN:
+// стандартный <mdspan> (C++23) или эталонная реализация
+// <experimental/mdspan> под C++20
+#if defined(S21_MATRIX_MDSPAN)
+#include <array>
+#include <version>
+#if defined(__cpp_lib_mdspan)
+#include <mdspan>
+namespace s21_md = std;
+#else
+#include <experimental/mdspan>
+namespace s21_md = std::experimental;
+#endif
+#endif
+
+#include "s21_parallel.h"
+#include "s21_vector.h"
+
+// Способ сравнения элементов: абсолютная или относительная разность,
+// либо расстояние в единицах последнего разряда (ULP)
+enum class S21Tolerance { kAbsolute, kRelative, kUlp };
+
+struct S21Comparison {
+  bool equal;
+  double max_deviation;  // в единицах выбранного режима
+  int max_row, max_col;  // позиция максимального отклонения
+  int mismatch_row, mismatch_col;  // первое несовпадение или -1
+};
+
+// Суммирование в редукциях: kPlain — четыре независимые суммы
+// (векторизуется), kPairwise — попарное с ошибкой O(log n),
+// kKahan — компенсированное (Кэхэн-Бабушка), самое точное и медленное
+enum class S21Summation { kPlain, kPairwise, kKahan };
+
+struct S21Extremum {
+  double value;
+  int row, col;  // первое вхождение; -1 у пустой матрицы
+};
+
+// Порядок умножения цепочки: сомножители по номерам, например "(0 (1 2))"
+struct S21ChainPlan {
+  double multiplications;  // скалярных умножений
+  std::string order;
+};
+
+struct S21RefinementResult;
+struct S21EigenResult;
+struct S21QRResult;
+struct S21SvdResult;
+
+// Неявно заданная матрица: y = A x
+using S21LinearOperator = std::function<void(const S21Vector& x, S21Vector& y)>;
+
+// kEigen использует разложение симметричной матрицы: A^n = V L^n V^T
+enum class S21PowMethod { kSquaring, kEigen };
+
+// Рандомизированное SVD: k + oversampling случайных направлений и
+// power_iterations проходов A^T A для разделения близких сингулярных чисел
+struct S21LowRankOptions {
+  int oversampling = 10;
+  int power_iterations = 2;
+  unsigned long long seed = 42;
+};
+
+struct S21LanczosOptions {
+  int max_subspace = 0;  // 0: max(2k + 1, k + 20)
+  int max_restarts = 100;
+  double tolerance = 1e-10;  // относительно наибольшего по модулю значения
+  unsigned long long seed = 42;
+};
 
 class S21Matrix {
  private:
+  // Лениво вычисляемое LU-разложение, ранг и обратная матрица
+  struct Factorization;
+
   int rows_, cols_;
+  // Строки лежат в одном блоке, выровненном по 64 байтам, с шагом
+  // stride_ >= cols_; хвост строки не виден снаружи. Копии разделяют
+  // блок по атомарному счётчику ссылок, пока одна из них не изменится.
+  // У матрицы над внешним буфером строки лежат в нём
+  int stride_;
+  double* data_;
   double** matrix_;
+  mutable Factorization* factorization_;
+  bool cache_enabled_;
 
   void CreateMatrix();
   void FreeMatrix();
+  void ShareStorage(const S21Matrix& other);
+  // Перед записью: общий блок заменяется собственной копией
+  void Detach();
   S21Matrix GetMinorMatrix(int row, int col) const;
+  void InvalidateCache() const;
+  Factorization& GetFactorization() const;
+  // Обмен содержимым; настройка кэша остаётся у объекта
+  void Swap(S21Matrix& other) noexcept;
+  void CheckSameSize(const S21Matrix& other) const;
+  // Строк на один поток в поэлементных ядрах
+  static int ElementGrain(int cols) {
+    constexpr int kParallelElements = 1 << 15;
+    return std::max(1, kParallelElements / std::max(cols, 1));
+  }
 
  public:
+  // Освобождает внешний буфер, переданный во владение
+  using Deleter = std::function<void(double*)>;
+
   S21Matrix();
   S21Matrix(int rows, int cols);
+  // Матрица над внешним буфером: элемент (i, j) лежит в
+  // data[i * row_stride + j * col_stride]. Без deleter буфер
+  // заимствуется и должен пережить матрицу и её копии, с deleter он
+  // освобождается вместе с последней копией. Пока на буфер ссылается
+  // один объект, запись идёт прямо в буфер; записывающая копия
+  // получает собственный блок. Строки с col_stride != 1 или
+  // перекрывающиеся строки копируются сразу, и deleter вызывается
+  // в конструкторе. Если конструктор бросает исключение (неверные
+  // аргументы или нехватка памяти), deleter тоже уже вызван
+  S21Matrix(double* data, int rows, int cols, int row_stride,
+            int col_stride = 1, Deleter deleter = nullptr);
   S21Matrix(const S21Matrix& other);  // Конструктор копирования
   S21Matrix(S21Matrix&& other) noexcept;  // Конструктор переноса
   ~S21Matrix();
 
   int GetRows() const { return rows_; }
   int GetCols() const { return cols_; }
+  // Шаг между началами строк в элементах
+  int GetStride() const { return stride_; }
+  // Элементы лежат во внешнем буфере
+  bool IsExternal() const;
   void SetRows(int new_rows);
   void SetCols(int new_cols);
 
   bool EqMatrix(const S21Matrix& other) const;
+  // При stop_at_first проход прекращается на блоке с первым
+  // несовпадением, и max_deviation считается только по просмотренной части
+  S21Comparison Compare(const S21Matrix& other, double tolerance,
+                        S21Tolerance mode = S21Tolerance::kAbsolute,
+                        bool stop_at_first = false) const;
   void SumMatrix(const S21Matrix& other);
   void SubMatrix(const S21Matrix& other);
   void MulNumber(const double num);
   void MulMatrix(const S21Matrix& other);
-  S21Matrix Transpose();
+  S21Matrix Transpose() const;
   S21Matrix CalcComplements();
-  double Determinant();
-  S21Matrix InverseMatrix();
+  double Determinant() const;
+  S21Matrix InverseMatrix() const;
+  S21Matrix Solve(const S21Matrix& b) const;
+  int Rank() const;
+  // Точные определитель (десятичной строкой) и ранг матрицы из целых
+  // чисел: Bareiss в int64, при переполнении — в __int128, затем по
+  // модулям простых чисел с восстановлением по китайской теореме об
+  // остатках. Дробные элементы — std::invalid_argument
+  std::string ExactDeterminant() const;
+  int ExactRank() const;
+  // Разложение во float и уточнение невязки в double; если уточнение
+  // не сходится, решение пересчитывается обычным Solve. Выгодно при
+  // немногих столбцах b: для одного столбца в Release на одном ядре
+  // 1.3 мс против 1.7 мс у Solve при n = 200 и 96 мс против 177 мс
+  // при n = 1000. Каждый шаг считает невязку полным Gemm, поэтому для
+  // обратной матрицы (b = I) путь в 3-4.6 раза медленнее InverseMatrix
+  S21RefinementResult SolveRefined(const S21Matrix& b,
+                                   int max_iterations = 10,
+                                   double tolerance = 0.0) const;
+
+  // Все собственные пары симметричной матрицы (Хаусхолдер + QL),
+  // значения по убыванию, векторы — столбцы
+  S21EigenResult EigenSymmetric() const;
+  // k наибольших собственных пар симметричной матрицы методом Ланцоша
+  // с толстым перезапуском: O(k n^2) на перезапуск и O(k n) памяти
+  S21EigenResult TopEigen(
+      int k, const S21LanczosOptions& options = S21LanczosOptions()) const;
+  static S21EigenResult TopEigen(
+      int n, int k, const S21LinearOperator& op,
+      const S21LanczosOptions& options = S21LanczosOptions());
+
+  // Тонкое QR отражениями Хаусхолдера: Q — m x p с ортонормированными
+  // столбцами, R — верхнетреугольная p x n, p = min(m, n)
+  S21QRResult QR() const;
+  // Приближение ранга k: A ~ U diag(sigma) V^T по случайной проекции
+  // (Halko, Martinsson, Tropp). Элементы A читаются за 2 + 2q
+  // последовательных прохода, время O(mn (k + p) (q + 1)); одинаковый
+  // seed даёт одинаковый результат
+  S21SvdResult LowRank(
+      int k, const S21LowRankOptions& options = S21LowRankOptions()) const;
+
+  // A^n за O(log n) умножений; n < 0 — степень обратной матрицы
+  S21Matrix Pow(int n, S21PowMethod method = S21PowMethod::kSquaring) const;
+
+  // Произведение цепочки A1 * A2 * ... * An в порядке скобок с
+  // минимальным числом умножений (динамическое программирование)
+  static S21Matrix MulChain(const std::vector<const S21Matrix*>& chain);
+  // Порядок, который выберет MulChain для сомножителей
+  // dims[i] x dims[i + 1]
+  static S21ChainPlan PlanChain(const std::vector<int>& dims);
+
+  // Асинхронные варианты выполняются на S21Executor; операнды копируются
+  // в момент вызова, и их можно изменять, не дожидаясь результата
+  std::future<S21Matrix> SumMatrixAsync(const S21Matrix& other) const;
+  std::future<S21Matrix> SubMatrixAsync(const S21Matrix& other) const;
+  std::future<S21Matrix> MulMatrixAsync(const S21Matrix& other) const;
+  std::future<S21Matrix> InverseAsync() const;
+  std::future<double> DeterminantAsync() const;
+  std::future<S21Matrix> SolveAsync(const S21Matrix& b) const;
+
+  // y = alpha * op(A) * x + beta * y, где op(A) = A или A^T
+  void Gemv(double alpha, const S21Vector& x, double beta, S21Vector& y,
+            bool transpose = false) const;
+  S21Vector MulVector(const S21Vector& x) const;
+  S21Vector MulVectorTransposed(const S21Vector& x) const;
+  // C = alpha * op(A) * op(B) + beta * C без выделения памяти,
+  // C — текущая матрица заранее заданного размера
+  void Gemm(double alpha, const S21Matrix& a, const S21Matrix& b, double beta,
+            bool trans_a = false, bool trans_b = false);
+
+  // Поэлементные произведение и частное: на месте и с новым результатом.
+  // Деление на ноль даёт inf или nan по IEEE 754
+  void HadamardProduct(const S21Matrix& other);
+  void HadamardDivide(const S21Matrix& other);
+  static S21Matrix HadamardProduct(const S21Matrix& a, const S21Matrix& b);
+  static S21Matrix HadamardDivide(const S21Matrix& a, const S21Matrix& b);
+  // Кронекерово произведение: блок (i, j) равен a(i, j) * b
+  static S21Matrix Kronecker(const S21Matrix& a, const S21Matrix& b);
+  // y = (A ⊗ B) x без построения произведения: vec(A X B^T) за
+  // O(mnp + npq) вместо O(mnpq); x — построчная развёртка X (n x q)
+  static S21LinearOperator KroneckerOperator(const S21Matrix& a,
+                                             const S21Matrix& b);
+
+  // Редукции за один проход по памяти. Частичные результаты берутся по
+  // фиксированным блокам строк, поэтому итог не зависит от числа потоков
+  double Trace() const;
+  double Sum(S21Summation mode = S21Summation::kPlain) const;
+  // При переполнении или потере значимости квадратов — второй проход
+  // с масштабированием
+  double FrobeniusNorm(S21Summation mode = S21Summation::kPlain) const;
+  // Нормы и MaxAbs равны nan, если в матрице есть nan
+  double Norm1() const;    // максимальная сумма модулей по столбцам
+  double NormInf() const;  // максимальная сумма модулей по строкам
+  double MaxAbs() const;
+  // nan пропускаются, если в матрице есть хоть одно число
+  S21Extremum ArgMin() const;
+  S21Extremum ArgMax() const;
+
+  // A += u v^T и A += U C V^T (U, V — n x k, C — k x k). Кэшированные
+  // обратная матрица и определитель поправляются по формуле
+  // Шермана-Моррисона-Вудбери за O(k n^2), а к LU добавляется поправка,
+  // так что Solve не разлагает матрицу заново. Если LU в кэше нет или
+  // поправка численно опасна, кэш сбрасывается и следующий запрос
+  // считает его заново. Возвращает true, если кэш был поправлен
+  bool RankOneUpdate(const S21Vector& u, const S21Vector& v);
+  bool LowRankUpdate(const S21Matrix& u, const S21Matrix& c,
+                     const S21Matrix& v);
+  // Замена строки i как поправка ранга 1
+  bool ReplaceRow(int i, const S21Vector& row);
+
+  // Поэлементное применение функции. Вызов f встраивается во
+  // внутренний цикл по строке, крупные матрицы делятся между потоками
+  // пула, поэтому f должна допускать одновременные вызовы
+  template <class F>
+  void Apply(F f);  // x = f(x) на месте
+  template <class F>
+  S21Matrix Map(F f) const;
+  template <class F>
+  void ZipWith(const S21Matrix& other, F f);  // x = f(x, y) на месте
+  template <class F>
+  static S21Matrix ZipWith(const S21Matrix& a, const S21Matrix& b, F f);
+
+  // Кэш разложения сбрасывается любой изменяющей операцией,
+  // отключение освобождает память кэша. Кэш заполняется и в
+  // const-методах, поэтому одновременные запросы к одному объекту
+  // из разных потоков требуют внешней синхронизации
+  void SetCacheEnabled(bool enabled);
+  bool IsCacheEnabled() const { return cache_enabled_; }
 
   S21Matrix operator+(const S21Matrix& other) const;
   S21Matrix operator-(const S21Matrix& other) const;
@@ -45,8 +294,141 @@ class S21Matrix {
   S21Matrix& operator*=(const double num);
   S21Matrix& operator*=(const S21Matrix& other);
 
+  // Изменяемый доступ отделяет общий блок и сбрасывает кэш. Как и у
+  // Row, ссылка, полученная до копирования матрицы, пишет и в копию,
+  // поэтому её не следует хранить
   double& operator()(int i, int j);
   double operator()(int i, int j) const;
+  // Строка целиком (cols_ подряд идущих элементов) для блочных ядер;
+  // проверяется только номер строки, изменяемый вариант отделяет общий
+  // блок и сбрасывает кэш. Указатель, полученный до копирования
+  // матрицы, пишет и в копию, поэтому его не следует хранить
+  double* Row(int i);
+  const double* Row(int i) const;
+
+#if defined(S21_MATRIX_MDSPAN)
+  using MdSpan = s21_md::mdspan<double, s21_md::dextents<int, 2>,
+                                s21_md::layout_stride>;
+  using ConstMdSpan = s21_md::mdspan<const double, s21_md::dextents<int, 2>,
+                                     s21_md::layout_stride>;
+
+  // Матрица над данными mdspan, как конструктор над внешним буфером
+  template <class Extents, class Layout>
+  explicit S21Matrix(s21_md::mdspan<double, Extents, Layout> view,
+                     Deleter deleter = nullptr);
+  // Представление элементов без копирования. Действует как Row:
+  // изменяемый вариант отделяет общий блок, и после копирования
+  // матрицы представление не следует хранить
+  MdSpan View();
+  ConstMdSpan View() const;
+#endif
+};
+
+#if defined(S21_MATRIX_MDSPAN)
+template <class Extents, class Layout>
+S21Matrix::S21Matrix(s21_md::mdspan<double, Extents, Layout> view,
+                     Deleter deleter)
+    : S21Matrix(view.data_handle(), static_cast<int>(view.extent(0)),
+                static_cast<int>(view.extent(1)),
+                static_cast<int>(view.stride(0)),
+                static_cast<int>(view.stride(1)), std::move(deleter)) {
+  static_assert(Extents::rank() == 2, "Matrix view must have rank 2");
+}
+
+inline S21Matrix::MdSpan S21Matrix::View() {
+  Detach();
+  InvalidateCache();
+  return MdSpan(matrix_ != nullptr ? matrix_[0] : nullptr,
+                MdSpan::mapping_type(s21_md::dextents<int, 2>(rows_, cols_),
+                                     std::array<int, 2>{stride_, 1}));
+}
+
+inline S21Matrix::ConstMdSpan S21Matrix::View() const {
+  return ConstMdSpan(
+      matrix_ != nullptr ? matrix_[0] : nullptr,
+      ConstMdSpan::mapping_type(s21_md::dextents<int, 2>(rows_, cols_),
+                                std::array<int, 2>{stride_, 1}));
+}
+#endif
+
+template <class F>
+void S21Matrix::Apply(F f) {
+  Detach();
+  InvalidateCache();
+  S21ParallelFor(0, rows_, ElementGrain(cols_), [&](int from, int to) {
+    for (int i = from; i < to; ++i) {
+      double* row = matrix_[i];
+      for (int j = 0; j < cols_; ++j) row[j] = f(row[j]);
+    }
+  });
+}
+
+template <class F>
+S21Matrix S21Matrix::Map(F f) const {
+  S21Matrix result(rows_, cols_);
+  S21ParallelFor(0, rows_, ElementGrain(cols_), [&](int from, int to) {
+    for (int i = from; i < to; ++i) {
+      const double* row = matrix_[i];
+      double* out = result.matrix_[i];
+      for (int j = 0; j < cols_; ++j) out[j] = f(row[j]);
+    }
+  });
+  return result;
+}
+
+template <class F>
+void S21Matrix::ZipWith(const S21Matrix& other, F f) {
+  CheckSameSize(other);
+  Detach();
+  InvalidateCache();
+  S21ParallelFor(0, rows_, ElementGrain(cols_), [&](int from, int to) {
+    for (int i = from; i < to; ++i) {
+      double* row = matrix_[i];
+      const double* y = other.matrix_[i];
+      for (int j = 0; j < cols_; ++j) row[j] = f(row[j], y[j]);
+    }
+  });
+}
+
+template <class F>
+S21Matrix S21Matrix::ZipWith(const S21Matrix& a, const S21Matrix& b, F f) {
+  a.CheckSameSize(b);
+  S21Matrix result(a.rows_, a.cols_);
+  S21ParallelFor(0, a.rows_, ElementGrain(a.cols_), [&](int from, int to) {
+    for (int i = from; i < to; ++i) {
+      const double* x = a.matrix_[i];
+      const double* y = b.matrix_[i];
+      double* out = result.matrix_[i];
+      for (int j = 0; j < a.cols_; ++j) out[j] = f(x[j], y[j]);
+    }
+  });
+  return result;
+}
+
+struct S21RefinementResult {
+  S21Matrix solution;
+  int iterations;   // число шагов уточнения
+  double residual;  // max_j |b_j - A x_j| / (|A| |x_j|), норма inf
+  bool converged;   // точность достигнута на float-разложении
+  bool fallback;    // решение получено double-разложением
+};
+
+struct S21EigenResult {
+  S21Vector values;   // по убыванию
+  S21Matrix vectors;  // n x k, по столбцам
+  int iterations;     // число перезапусков
+  bool converged;
+};
+
+struct S21QRResult {
+  S21Matrix q;  // m x p
+  S21Matrix r;  // p x n
+};
+
+struct S21SvdResult {
+  S21Matrix u;      // m x k, по столбцам
+  S21Vector sigma;  // по убыванию
+  S21Matrix vt;     // k x n, по строкам
 };
 
 #endif
\ No newline at end of file
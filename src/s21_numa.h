@@ -0,0 +1,67 @@
+#ifndef S21_NUMA_H
+#define S21_NUMA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class S21Matrix;
+
+// Размещение крупных матриц по узлам NUMA (блоки от kMinBytes):
+// kDefault — как раньше, страницы трогает создающий поток;
+// kFirstTouch — нули пишут потоки пула теми же блоками строк, что и
+// поэлементные ядра, и страницы попадают на узлы будущих владельцев;
+// kInterleave — страницы по очереди со всех узлов;
+// kLocal — предпочтительно узел создающего потока
+enum class S21NumaPolicy { kDefault, kFirstTouch, kInterleave, kLocal };
+
+struct S21NumaNode {
+  int id;
+  std::vector<int> cpus;
+  std::uint64_t total_bytes, free_bytes;  // 0, если неизвестно
+};
+
+// Только Linux; на других системах политики сводятся к kDefault.
+// Переменные окружения при старте: S21_NUMA_POLICY=default,
+// first-touch, interleave или local и S21_NUMA_PIN=1
+class S21Numa {
+ public:
+  static constexpr std::size_t kMinBytes = 2 << 20;
+
+  // Узлы из /sys/devices/system/node; без NUMA — один узел со всеми CPU
+  static const std::vector<S21NumaNode>& Nodes();
+
+  static void SetPolicy(S21NumaPolicy policy);
+  static S21NumaPolicy GetPolicy();
+  // Политика для блока данных такого размера
+  static S21NumaPolicy PolicyFor(std::size_t bytes);
+  // Привязывает страницы блока по политике kInterleave или kLocal до
+  // первой записи в него
+  static void Bind(void* data, std::size_t bytes, S21NumaPolicy policy);
+
+  // Закрепление рабочих потоков пула за ядрами, по очереди с разных
+  // узлов. При закреплении S21ParallelFor отдаёт блок i всегда одному и
+  // тому же потоку, так что страницы, тронутые им при создании
+  // матрицы, остаются локальными и в следующих ядрах
+  static void SetPinning(bool pinned);
+  static bool IsPinned();
+  // CPU рабочего потока с номером worker; -1, если не закреплён
+  static int WorkerCpu(int worker);
+  // Вызывается рабочим потоком при старте и при смене режима
+  static void PinCurrentWorker(int worker);
+
+  // Число страниц диапазона на каждом узле (move_pages); ещё не
+  // тронутые страницы не учитываются
+  static std::vector<long> Placement(const void* data, std::size_t bytes);
+  static std::vector<long> Placement(const S21Matrix& m);
+
+  // Учёт крупных выделений при включённой телеметрии
+  static void RecordAllocation(S21NumaPolicy policy, std::size_t bytes);
+  static void ResetCounters();
+  // Метрики для S21Telemetry::Dump и текстовый отчёт по узлам
+  static std::string Dump();
+  static std::string Report();
+};
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <functional>
+
+// Число потоков, на которые делятся крупные ядра: переменная окружения
+// S21_NUM_THREADS или число аппаратных потоков
+int S21ThreadCount();
+
+// Делит [begin, end) на непрерывные блоки не короче grain и вызывает
+// body(block_begin, block_end) на нескольких потоках, дожидаясь всех
+void S21ParallelFor(int begin, int end, int grain,
+                    const std::function<void(int, int)>& body);
+
+#endif
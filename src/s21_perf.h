@@ -0,0 +1,88 @@
+#ifndef S21_PERF_H
+#define S21_PERF_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class S21Op;
+
+// Аппаратные счётчики, снимаемые через perf_event_open
+enum class S21PerfEvent {
+  kCycles,
+  kInstructions,
+  kL1dMisses,
+  kLlcMisses,
+  kDtlbMisses,
+  kBranchMisses,
+  kCount
+};
+
+constexpr int kS21PerfEventCount = static_cast<int>(S21PerfEvent::kCount);
+
+// Показания счётчиков потока в один момент времени. В values входит
+// и работа рабочих потоков над блоками S21ParallelFor этого потока;
+// helper_cycles — их доля тактов
+struct S21PerfSample {
+  bool valid = false;
+  std::uint64_t values[kS21PerfEventCount] = {};
+  std::uint64_t time_enabled = 0, time_running = 0;
+  std::uint64_t helper_cycles = 0;
+};
+
+// Сумма по операции и размерной корзине: число элементов
+// лежит в [2^size_bucket, 2^(size_bucket + 1))
+struct S21PerfStats {
+  const char* name;
+  int size_bucket;
+  std::uint64_t calls;
+  std::uint64_t counted_calls;  // вызовы, для которых счётчики работали
+  std::uint64_t total_ns;
+  std::uint64_t flops;
+  std::uint64_t bytes;
+  std::uint64_t counters[kS21PerfEventCount];  // всех участников
+  std::uint64_t own_cycles;  // такты только вызывающего потока
+};
+
+// Режим профилирования ядер (только Linux, сборка с S21_MATRIX_PERF).
+// Каждая область S21_TELEMETRY_SCOPE снимает счётчики вызывающего потока
+// на входе и выходе. Рабочие потоки снимают свои счётчики вокруг каждого
+// блока S21ParallelFor, и приращения прибавляются к показаниям потока,
+// запустившего цикл, поэтому IPC и MPKI параллельных ядер считаются по
+// всем участникам. Если ядро или гипервизор не дают счётчиков,
+// собирается только время.
+// Переменная окружения S21_MATRIX_PERF=1 включает режим при старте
+class S21Perf {
+ public:
+#if defined(S21_MATRIX_PERF) && defined(__linux__)
+  static constexpr bool kCompiled = true;
+#else
+  static constexpr bool kCompiled = false;
+#endif
+
+  static void SetEnabled(bool enabled);
+  static bool IsEnabled();
+  // Открылся ли счётчик хотя бы в одном потоке
+  static bool IsAvailable(S21PerfEvent event);
+  static void Reset();
+  static std::vector<S21PerfStats> Snapshot();
+  // Таблица с производными метриками: IPC, байт на флоп, MPKI и
+  // GFLOP/s относительно пика; при peak_gflops == 0 пик оценивается
+  // по частоте вызывающего потока, 16 флопам за такт (AVX2 + FMA) и
+  // S21ThreadCount() потокам
+  static std::string Report(double peak_gflops = 0.0);
+
+  static void Read(S21PerfSample& sample);
+  // Приращение счётчиков рабочего потока за блок, приведённое к полному
+  // времени при мультиплексировании, прибавляется к total
+  static void Accumulate(const S21PerfSample& start, const S21PerfSample& end,
+                         S21PerfSample& total);
+  // Сумма блоков, выполненных рабочими потоками за вызывающий поток:
+  // попадает в его следующие показания
+  static void AddHelperWork(const S21PerfSample& total);
+  static void Record(S21Op op, std::uint64_t ns, std::uint64_t elements,
+                     std::uint64_t flops, std::uint64_t bytes,
+                     const S21PerfSample& start, const S21PerfSample& end);
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef S21_STRUCTURED_H
+#define S21_STRUCTURED_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Квадратные матрицы специального вида с компактным хранением.
+// Чтение элемента вне структуры даёт 0, запись туда — out_of_range
+
+// Диагональная: n элементов, произведение с плотной — O(n m)
+class S21DiagonalMatrix {
+ public:
+  explicit S21DiagonalMatrix(int n);
+
+  int GetSize() const { return n_; }
+  double& operator()(int i);
+  double operator()(int i, int j) const;
+
+  S21Matrix ToDense() const;
+  S21Matrix MulMatrix(const S21Matrix& other) const;  // D * A
+  S21Vector MulVector(const S21Vector& x) const;
+  S21Matrix Solve(const S21Matrix& b) const;
+  double Determinant() const;
+
+ private:
+  int n_;
+  std::vector<double> values_;
+};
+
+S21Matrix operator*(const S21DiagonalMatrix& d, const S21Matrix& a);
+S21Matrix operator*(const S21Matrix& a, const S21DiagonalMatrix& d);
+
+// Треугольная, упакованная по строкам: n(n+1)/2 элементов
+class S21TriangularMatrix {
+ public:
+  S21TriangularMatrix(int n, bool upper);
+
+  int GetSize() const { return n_; }
+  bool IsUpper() const { return upper_; }
+  double& operator()(int i, int j);
+  double operator()(int i, int j) const;
+
+  S21Matrix ToDense() const;
+  S21Matrix MulMatrix(const S21Matrix& other) const;
+  S21Vector MulVector(const S21Vector& x) const;
+  // Прямая или обратная подстановка, O(n^2) на столбец
+  S21Matrix Solve(const S21Matrix& b) const;
+  double Determinant() const;
+
+ private:
+  long long Index(int i, int j) const;
+
+  int n_;
+  bool upper_;
+  std::vector<double> values_;
+};
+
+// Симметричная, хранится нижний треугольник по строкам
+class S21SymmetricMatrix {
+ public:
+  explicit S21SymmetricMatrix(int n);
+
+  int GetSize() const { return n_; }
+  double& operator()(int i, int j);
+  double operator()(int i, int j) const;
+
+  S21Matrix ToDense() const;
+  S21Matrix MulMatrix(const S21Matrix& other) const;
+  S21Vector MulVector(const S21Vector& x) const;
+  // Через разложение Холецкого; для незнакоопределённой матрицы —
+  // плотное LU
+  S21Matrix Solve(const S21Matrix& b) const;
+  double Determinant() const;
+
+ private:
+  long long Index(int i, int j) const;
+  bool Cholesky(S21TriangularMatrix& lower) const;
+
+  int n_;
+  std::vector<double> values_;
+};
+
+// Ленточная с lower поддиагоналями и upper наддиагоналями:
+// n (lower + upper + 1) элементов, трёхдиагональная решается за O(n)
+class S21BandedMatrix {
+ public:
+  S21BandedMatrix(int n, int lower, int upper);
+
+  int GetSize() const { return n_; }
+  int GetLower() const { return lower_; }
+  int GetUpper() const { return upper_; }
+  double& operator()(int i, int j);
+  double operator()(int i, int j) const;
+
+  S21Matrix ToDense() const;
+  S21Matrix MulMatrix(const S21Matrix& other) const;
+  S21Vector MulVector(const S21Vector& x) const;
+  // Гаусс с выбором ведущего элемента внутри ленты:
+  // O(n lower (lower + upper)) на разложение
+  S21Matrix Solve(const S21Matrix& b) const;
+  double Determinant() const;
+
+ private:
+  bool InBand(int i, int j) const;
+  // LU-разложение в ленте шириной 2 lower + upper + 1
+  bool Factorize(std::vector<double>& lu, std::vector<int>& pivots,
+                 double& det) const;
+
+  int n_, lower_, upper_;
+  std::vector<double> values_;  // n строк по lower + upper + 1
+};
+
+#endif
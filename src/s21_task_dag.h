@@ -0,0 +1,43 @@
+#ifndef S21_TASK_DAG_H
+#define S21_TASK_DAG_H
+
+#include <functional>
+#include <vector>
+
+// Граф мелких задач над блоками данных для тайловых алгоритмов.
+// Задача объявляет, какие блоки (целые номера) читает и пишет, и
+// зависимости выводятся из порядка добавления, как у depend в OpenMP:
+// чтение ждёт последней записи, запись — записи и всех чтений после неё.
+// Run раздаёт готовые задачи участникам с собственными очередями:
+// участник берёт свои задачи с конца, а без работы крадёт чужие с
+// начала. Критические задачи (путь через панели) лежат в общей очереди
+// и берутся раньше остальных, так что следующая панель считается, пока
+// идут обновления текущего шага
+class S21TaskDag {
+ public:
+  using Task = int;
+
+  Task Add(std::function<void()> body, const std::vector<int>& reads,
+           const std::vector<int>& writes, bool critical = false);
+  int Size() const { return static_cast<int>(tasks_.size()); }
+  // Выполняет все задачи и очищает граф; первое исключение из задачи
+  // пробрасывается, когда оставшиеся задачи пропущены
+  void Run();
+
+ private:
+  struct TaskData {
+    std::function<void()> body;
+    std::vector<Task> successors;
+    int dependencies = 0;
+    bool critical = false;
+  };
+  struct BlockState {
+    Task writer = -1;
+    std::vector<Task> readers;
+  };
+
+  std::vector<TaskData> tasks_;
+  std::vector<BlockState> blocks_;
+};
+
+#endif
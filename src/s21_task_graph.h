@@ -0,0 +1,50 @@
+#ifndef S21_TASK_GRAPH_H
+#define S21_TASK_GRAPH_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Граф операций над матрицами. Независимые узлы выполняются
+// параллельно на S21Executor, промежуточный результат освобождается,
+// как только его прочитал последний потребитель
+class S21TaskGraph {
+ public:
+  using Node = int;
+  using Operation =
+      std::function<S21Matrix(const std::vector<const S21Matrix*>& inputs)>;
+
+  Node AddInput(S21Matrix value);
+  Node AddNode(Operation operation, std::vector<Node> inputs);
+  Node Sum(Node a, Node b);
+  Node Sub(Node a, Node b);
+  Node Mul(Node a, Node b);
+  Node Transpose(Node a);
+  Node Inverse(Node a);
+
+  // Результат узла сохраняется после Run; узлы без потребителей
+  // сохраняются всегда
+  void KeepResult(Node node);
+  // Выполняет граф и дожидается завершения; первое исключение
+  // из узла пробрасывается после остановки оставшихся задач
+  void Run();
+  const S21Matrix& Result(Node node) const;
+
+ private:
+  struct NodeData {
+    Operation operation;
+    std::vector<Node> inputs;
+    std::vector<Node> consumers;
+    bool is_input = false;
+    bool keep = false;
+    std::unique_ptr<S21Matrix> value;
+  };
+
+  void CheckNode(Node node) const;
+
+  std::vector<NodeData> nodes_;
+};
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef S21_TELEMETRY_H
+#define S21_TELEMETRY_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "s21_perf.h"
+
+// Операции S21Matrix, по которым собирается статистика
+enum class S21Op {
+  kCreateMatrix,
+  kCopy,
+  kMove,
+  kAssign,
+  kSumMatrix,
+  kSubMatrix,
+  kMulNumber,
+  kMulMatrix,
+  kGemm,
+  kGemv,
+  kTranspose,
+  kCalcComplements,
+  kDeterminant,
+  kInverseMatrix,
+  kSolve,
+  kRank,
+  kCompare,
+  kSolveRefined,
+  kMulChain,
+  kEigen,
+  kPow,
+  kHadamard,
+  kKronecker,
+  kReduce,
+  kLowRankUpdate,
+  kExactDeterminant,
+  kExactRank,
+  kQR,
+  kLowRank,
+  kAdopt,
+  kCount
+};
+
+struct S21OpStats {
+  const char* name;
+  std::uint64_t calls;
+  std::uint64_t total_ns;
+  std::uint64_t max_ns;
+  std::uint64_t elements;
+  std::uint64_t bytes;  // выделено в куче
+};
+
+// Счётчики ведутся в потоковых структурах без блокировок и
+// суммируются только при запросе снимка. Без S21_MATRIX_TELEMETRY
+// слой не компилируется в методы матрицы вовсе
+class S21Telemetry {
+ public:
+#ifdef S21_MATRIX_TELEMETRY
+  static constexpr bool kCompiled = true;
+#else
+  static constexpr bool kCompiled = false;
+#endif
+
+  static void SetEnabled(bool enabled);
+  static bool IsEnabled();
+  static void Reset();
+  static const char* OpName(S21Op op);
+  static std::vector<S21OpStats> Snapshot();
+  // Текстовый формат Prometheus: одна метрика на строку
+  static std::string Dump();
+
+  static void Record(S21Op op, std::uint64_t ns, std::uint64_t elements,
+                     std::uint64_t bytes);
+};
+
+// Замеряет время жизни области видимости и записывает его в S21Telemetry,
+// а в режиме профилирования — ещё и приращения счётчиков в S21Perf.
+// traffic и flops — модельные объёмы трафика памяти и работы ядра, они
+// идут только в S21Perf; в S21Telemetry попадают выделенные байты
+class S21TelemetryScope {
+ public:
+  S21TelemetryScope(S21Op op, long long elements, long long traffic = 0,
+                    long long flops = 0, long long allocated = 0);
+  ~S21TelemetryScope();
+  S21TelemetryScope(const S21TelemetryScope&) = delete;
+  S21TelemetryScope& operator=(const S21TelemetryScope&) = delete;
+
+ private:
+  S21Op op_;
+  bool active_, perf_;
+  long long elements_, traffic_, flops_, allocated_;
+  std::chrono::steady_clock::time_point start_;
+  S21PerfSample perf_start_;
+};
+
+#ifdef S21_MATRIX_TELEMETRY
+#define S21_TELEMETRY_CONCAT_(a, b) a##b
+#define S21_TELEMETRY_NAME_(line) S21_TELEMETRY_CONCAT_(s21_telemetry_, line)
+#define S21_TELEMETRY_SCOPE(...) \
+  S21TelemetryScope S21_TELEMETRY_NAME_(__LINE__)(__VA_ARGS__)
+#else
+#define S21_TELEMETRY_SCOPE(...) static_cast<void>(0)
+#endif
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef S21_TILED_H
+#define S21_TILED_H
+
+// Тайловые LU и Холецкий: матрица делится на квадратные тайлы, шаги
+// разложения (панель, треугольное решение, обновление тайла) становятся
+// задачами S21TaskDag. Обновление тайла начинается, как только готовы
+// его операнды, без общего барьера после каждой панели. Матрица задаётся
+// указателями на строки, разложение выполняется на месте
+class S21Tiled {
+ public:
+  // С этого размера тайловые версии заменяют построчные в кэше
+  // разложений S21Matrix и в S21SymmetricMatrix
+  static constexpr int kMinSize = 2000;
+  static constexpr int kTile = 128;
+
+  // PA = LU с выбором ведущего элемента по столбцу, в формате
+  // S21Matrix::Factorization: строка k переставлена со строкой
+  // pivots[k]. Ведущие элементы не больше tolerance пропускаются;
+  // возвращает false, если такие были
+  static bool LU(double** a, int n, int* pivots, double tolerance,
+                 int tile = kTile);
+  // A = L L^T по нижнему треугольнику, верхний не читается и не
+  // меняется. Возвращает false, если матрица не положительно определена
+  static bool Cholesky(double** a, int n, int tile = kTile);
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef S21_VECTOR_H
+#define S21_VECTOR_H
+
+#include <stdexcept>
+
+// Плотный вектор-столбец для произведений матрица-вектор
+class S21Vector {
+ private:
+  int size_;
+  double* data_;
+
+ public:
+  S21Vector();
+  explicit S21Vector(int size);
+  S21Vector(const S21Vector& other);
+  S21Vector(S21Vector&& other) noexcept;
+  ~S21Vector();
+
+  int GetSize() const { return size_; }
+  double* Data() { return data_; }
+  const double* Data() const { return data_; }
+
+  bool EqVector(const S21Vector& other) const;
+  void Fill(double value);
+
+  S21Vector& operator=(const S21Vector& other);
+  S21Vector& operator=(S21Vector&& other) noexcept;
+  bool operator==(const S21Vector& other) const;
+
+  double& operator()(int i);
+  double operator()(int i) const;
+};
+
+#endif
@@ -0,0 +1,487 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "s21_structured.h"
+#include "s21_tiled.h"
+
+namespace {
+
+void CheckSize(int n) {
+  if (n < 1) throw std::invalid_argument("Matrix size must be positive");
+}
+
+void CheckIndex(int n, int i, int j) {
+  if (i < 0 || i >= n || j < 0 || j >= n) {
+    throw std::out_of_range("Index out of bounds");
+  }
+}
+
+void CheckRows(int n, const S21Matrix& other) {
+  if (other.GetRows() != n) {
+    throw std::logic_error("Cols must be equal rows other matrix");
+  }
+}
+
+void CheckVector(int n, const S21Vector& x) {
+  if (x.GetSize() != n) {
+    throw std::logic_error("Vector size does not match matrix dimensions");
+  }
+}
+
+[[noreturn]] void ThrowSingular() {
+  throw std::logic_error("The determinant of the matrix is 0.");
+}
+
+// y += alpha * x
+void Axpy(double alpha, const double* x, double* y, int n) {
+  for (int j = 0; j < n; ++j) y[j] += alpha * x[j];
+}
+
+}  // namespace
+
+// Диагональная
+
+S21DiagonalMatrix::S21DiagonalMatrix(int n) : n_(n) {
+  CheckSize(n);
+  values_.assign(n, 0.0);
+}
+
+double& S21DiagonalMatrix::operator()(int i) {
+  CheckIndex(n_, i, i);
+  return values_[i];
+}
+
+double S21DiagonalMatrix::operator()(int i, int j) const {
+  CheckIndex(n_, i, j);
+  return i == j ? values_[i] : 0.0;
+}
+
+S21Matrix S21DiagonalMatrix::ToDense() const {
+  S21Matrix result(n_, n_);
+  for (int i = 0; i < n_; ++i) result(i, i) = values_[i];
+  return result;
+}
+
+S21Matrix S21DiagonalMatrix::MulMatrix(const S21Matrix& other) const {
+  CheckRows(n_, other);
+  int cols = other.GetCols();
+  S21Matrix result(n_, cols);
+  for (int i = 0; i < n_; ++i) {
+    const double* src = other.Row(i);
+    double* dst = result.Row(i);
+    for (int j = 0; j < cols; ++j) dst[j] = values_[i] * src[j];
+  }
+  return result;
+}
+
+S21Vector S21DiagonalMatrix::MulVector(const S21Vector& x) const {
+  CheckVector(n_, x);
+  S21Vector y(n_);
+  for (int i = 0; i < n_; ++i) y.Data()[i] = values_[i] * x.Data()[i];
+  return y;
+}
+
+S21Matrix S21DiagonalMatrix::Solve(const S21Matrix& b) const {
+  CheckRows(n_, b);
+  int cols = b.GetCols();
+  S21Matrix result(n_, cols);
+  for (int i = 0; i < n_; ++i) {
+    if (values_[i] == 0.0) ThrowSingular();
+    const double* src = b.Row(i);
+    double* dst = result.Row(i);
+    for (int j = 0; j < cols; ++j) dst[j] = src[j] / values_[i];
+  }
+  return result;
+}
+
+double S21DiagonalMatrix::Determinant() const {
+  double det = 1.0;
+  for (double value : values_) det *= value;
+  return det;
+}
+
+S21Matrix operator*(const S21DiagonalMatrix& d, const S21Matrix& a) {
+  return d.MulMatrix(a);
+}
+
+S21Matrix operator*(const S21Matrix& a, const S21DiagonalMatrix& d) {
+  int n = d.GetSize();
+  if (a.GetCols() != n) {
+    throw std::logic_error("Cols must be equal rows other matrix");
+  }
+  int rows = a.GetRows();
+  S21Matrix result(rows, n);
+  for (int i = 0; i < rows; ++i) {
+    const double* src = a.Row(i);
+    double* dst = result.Row(i);
+    for (int j = 0; j < n; ++j) dst[j] = src[j] * d(j, j);
+  }
+  return result;
+}
+
+// Треугольная
+
+S21TriangularMatrix::S21TriangularMatrix(int n, bool upper)
+    : n_(n), upper_(upper) {
+  CheckSize(n);
+  values_.assign(static_cast<size_t>(n) * (n + 1) / 2, 0.0);
+}
+
+long long S21TriangularMatrix::Index(int i, int j) const {
+  if (upper_) return 1LL * i * n_ - 1LL * i * (i - 1) / 2 + (j - i);
+  return 1LL * i * (i + 1) / 2 + j;
+}
+
+double& S21TriangularMatrix::operator()(int i, int j) {
+  CheckIndex(n_, i, j);
+  if (upper_ ? j < i : j > i) {
+    throw std::out_of_range("Element is outside the triangle");
+  }
+  return values_[Index(i, j)];
+}
+
+double S21TriangularMatrix::operator()(int i, int j) const {
+  CheckIndex(n_, i, j);
+  if (upper_ ? j < i : j > i) return 0.0;
+  return values_[Index(i, j)];
+}
+
+S21Matrix S21TriangularMatrix::ToDense() const {
+  S21Matrix result(n_, n_);
+  for (int i = 0; i < n_; ++i) {
+    int from = upper_ ? i : 0;
+    int to = upper_ ? n_ : i + 1;
+    const double* row = values_.data() + Index(i, from);
+    std::copy(row, row + (to - from), result.Row(i) + from);
+  }
+  return result;
+}
+
+S21Matrix S21TriangularMatrix::MulMatrix(const S21Matrix& other) const {
+  CheckRows(n_, other);
+  int cols = other.GetCols();
+  S21Matrix result(n_, cols);
+  for (int i = 0; i < n_; ++i) {
+    int from = upper_ ? i : 0;
+    int to = upper_ ? n_ : i + 1;
+    // row[k] — элемент (i, k) упакованной строки
+    const double* row = values_.data() + Index(i, from) - from;
+    double* dst = result.Row(i);
+    for (int k = from; k < to; ++k) {
+      Axpy(row[k], other.Row(k), dst, cols);
+    }
+  }
+  return result;
+}
+
+S21Vector S21TriangularMatrix::MulVector(const S21Vector& x) const {
+  CheckVector(n_, x);
+  S21Vector y(n_);
+  for (int i = 0; i < n_; ++i) {
+    int from = upper_ ? i : 0;
+    int to = upper_ ? n_ : i + 1;
+    const double* row = values_.data() + Index(i, from) - from;
+    double sum = 0.0;
+    for (int k = from; k < to; ++k) sum += row[k] * x.Data()[k];
+    y.Data()[i] = sum;
+  }
+  return y;
+}
+
+S21Matrix S21TriangularMatrix::Solve(const S21Matrix& b) const {
+  CheckRows(n_, b);
+  int cols = b.GetCols();
+  S21Matrix x(b);
+  for (int step = 0; step < n_; ++step) {
+    int i = upper_ ? n_ - 1 - step : step;
+    int from = upper_ ? i + 1 : 0;
+    int to = upper_ ? n_ : i;
+    const double* row = values_.data() + Index(i, i) - i;
+    if (row[i] == 0.0) ThrowSingular();
+    double* xi = x.Row(i);
+    for (int k = from; k < to; ++k) {
+      Axpy(-row[k], x.Row(k), xi, cols);
+    }
+    for (int j = 0; j < cols; ++j) xi[j] /= row[i];
+  }
+  return x;
+}
+
+double S21TriangularMatrix::Determinant() const {
+  double det = 1.0;
+  for (int i = 0; i < n_; ++i) det *= values_[Index(i, i)];
+  return det;
+}
+
+// Симметричная
+
+S21SymmetricMatrix::S21SymmetricMatrix(int n) : n_(n) {
+  CheckSize(n);
+  values_.assign(static_cast<size_t>(n) * (n + 1) / 2, 0.0);
+}
+
+long long S21SymmetricMatrix::Index(int i, int j) const {
+  if (j > i) std::swap(i, j);
+  return 1LL * i * (i + 1) / 2 + j;
+}
+
+double& S21SymmetricMatrix::operator()(int i, int j) {
+  CheckIndex(n_, i, j);
+  return values_[Index(i, j)];
+}
+
+double S21SymmetricMatrix::operator()(int i, int j) const {
+  CheckIndex(n_, i, j);
+  return values_[Index(i, j)];
+}
+
+S21Matrix S21SymmetricMatrix::ToDense() const {
+  S21Matrix result(n_, n_);
+  for (int i = 0; i < n_; ++i) {
+    double* row = result.Row(i);
+    for (int j = 0; j < n_; ++j) row[j] = values_[Index(i, j)];
+  }
+  return result;
+}
+
+S21Matrix S21SymmetricMatrix::MulMatrix(const S21Matrix& other) const {
+  CheckRows(n_, other);
+  int cols = other.GetCols();
+  S21Matrix result(n_, cols);
+  // Внедиагональный элемент нижнего треугольника даёт два вклада
+  for (int i = 0; i < n_; ++i) {
+    const double* row = values_.data() + Index(i, 0);
+    const double* src = other.Row(i);
+    double* dst = result.Row(i);
+    for (int k = 0; k < i; ++k) {
+      if (row[k] == 0.0) continue;
+      Axpy(row[k], other.Row(k), dst, cols);
+      Axpy(row[k], src, result.Row(k), cols);
+    }
+    Axpy(row[i], src, dst, cols);
+  }
+  return result;
+}
+
+S21Vector S21SymmetricMatrix::MulVector(const S21Vector& x) const {
+  CheckVector(n_, x);
+  S21Vector y(n_);
+  const double* xs = x.Data();
+  double* ys = y.Data();
+  for (int i = 0; i < n_; ++i) {
+    const double* row = values_.data() + Index(i, 0);
+    double sum = row[i] * xs[i];
+    for (int k = 0; k < i; ++k) {
+      sum += row[k] * xs[k];
+      ys[k] += row[k] * xs[i];
+    }
+    ys[i] += sum;
+  }
+  return y;
+}
+
+bool S21SymmetricMatrix::Cholesky(S21TriangularMatrix& lower) const {
+  if (n_ >= S21Tiled::kMinSize) {
+    // Тайловому разложению нужны целые строки: нижний треугольник
+    // разворачивается в плотную матрицу и собирается обратно
+    S21Matrix dense(n_, n_);
+    std::vector<double*> rows(n_);
+    for (int i = 0; i < n_; ++i) {
+      rows[i] = dense.Row(i);
+      const double* packed = values_.data() + Index(i, 0);
+      std::copy(packed, packed + i + 1, rows[i]);
+    }
+    if (!S21Tiled::Cholesky(rows.data(), n_)) return false;
+    for (int i = 0; i < n_; ++i) {
+      for (int j = 0; j <= i; ++j) lower(i, j) = rows[i][j];
+    }
+    return true;
+  }
+  for (int i = 0; i < n_; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      double sum = values_[Index(i, j)];
+      for (int k = 0; k < j; ++k) sum -= lower(i, k) * lower(j, k);
+      if (i == j) {
+        if (!(sum > 0.0)) return false;
+        lower(i, i) = std::sqrt(sum);
+      } else {
+        lower(i, j) = sum / lower(j, j);
+      }
+    }
+  }
+  return true;
+}
+
+S21Matrix S21SymmetricMatrix::Solve(const S21Matrix& b) const {
+  CheckRows(n_, b);
+  S21TriangularMatrix lower(n_, false);
+  if (!Cholesky(lower)) return ToDense().Solve(b);
+  S21TriangularMatrix upper(n_, true);
+  for (int i = 0; i < n_; ++i) {
+    for (int j = i; j < n_; ++j) upper(i, j) = lower(j, i);
+  }
+  return upper.Solve(lower.Solve(b));
+}
+
+double S21SymmetricMatrix::Determinant() const {
+  S21TriangularMatrix lower(n_, false);
+  if (!Cholesky(lower)) return ToDense().Determinant();
+  double det = lower.Determinant();
+  return det * det;
+}
+
+// Ленточная
+
+S21BandedMatrix::S21BandedMatrix(int n, int lower, int upper)
+    : n_(n), lower_(lower), upper_(upper) {
+  CheckSize(n);
+  if (lower < 0 || upper < 0 || lower >= n || upper >= n) {
+    throw std::invalid_argument("Bandwidth must be in [0, n)");
+  }
+  values_.assign(static_cast<size_t>(n) * (lower + upper + 1), 0.0);
+}
+
+bool S21BandedMatrix::InBand(int i, int j) const {
+  return j - i >= -lower_ && j - i <= upper_;
+}
+
+double& S21BandedMatrix::operator()(int i, int j) {
+  CheckIndex(n_, i, j);
+  if (!InBand(i, j)) throw std::out_of_range("Element is outside the band");
+  return values_[1LL * i * (lower_ + upper_ + 1) + (j - i + lower_)];
+}
+
+double S21BandedMatrix::operator()(int i, int j) const {
+  CheckIndex(n_, i, j);
+  if (!InBand(i, j)) return 0.0;
+  return values_[1LL * i * (lower_ + upper_ + 1) + (j - i + lower_)];
+}
+
+S21Matrix S21BandedMatrix::ToDense() const {
+  S21Matrix result(n_, n_);
+  for (int i = 0; i < n_; ++i) {
+    double* row = result.Row(i);
+    int last = std::min(n_ - 1, i + upper_);
+    for (int j = std::max(0, i - lower_); j <= last; ++j) {
+      row[j] = (*this)(i, j);
+    }
+  }
+  return result;
+}
+
+S21Matrix S21BandedMatrix::MulMatrix(const S21Matrix& other) const {
+  CheckRows(n_, other);
+  int cols = other.GetCols();
+  S21Matrix result(n_, cols);
+  for (int i = 0; i < n_; ++i) {
+    double* dst = result.Row(i);
+    int last = std::min(n_ - 1, i + upper_);
+    for (int j = std::max(0, i - lower_); j <= last; ++j) {
+      Axpy((*this)(i, j), other.Row(j), dst, cols);
+    }
+  }
+  return result;
+}
+
+S21Vector S21BandedMatrix::MulVector(const S21Vector& x) const {
+  CheckVector(n_, x);
+  S21Vector y(n_);
+  for (int i = 0; i < n_; ++i) {
+    double sum = 0.0;
+    int last = std::min(n_ - 1, i + upper_);
+    for (int j = std::max(0, i - lower_); j <= last; ++j) {
+      sum += (*this)(i, j) * x.Data()[j];
+    }
+    y.Data()[i] = sum;
+  }
+  return y;
+}
+
+bool S21BandedMatrix::Factorize(std::vector<double>& lu,
+                                std::vector<int>& pivots,
+                                double& det) const {
+  // Перестановки строк расширяют верхнюю ленту до upper + lower
+  int width = 2 * lower_ + upper_ + 1;
+  int reach = upper_ + lower_;
+  lu.assign(static_cast<size_t>(n_) * width, 0.0);
+  pivots.assign(n_, 0);
+  auto at = [&](int i, int j) -> double& {
+    return lu[1LL * i * width + (j - i + lower_)];
+  };
+
+  double max_abs = 0.0;
+  for (int i = 0; i < n_; ++i) {
+    int last = std::min(n_ - 1, i + upper_);
+    for (int j = std::max(0, i - lower_); j <= last; ++j) {
+      at(i, j) = (*this)(i, j);
+      max_abs = std::max(max_abs, std::fabs(at(i, j)));
+    }
+  }
+  double tolerance = n_ * std::numeric_limits<double>::epsilon() * max_abs;
+
+  det = 1.0;
+  for (int k = 0; k < n_; ++k) {
+    int last_row = std::min(n_ - 1, k + lower_);
+    int last_col = std::min(n_ - 1, k + reach);
+    int p = k;
+    for (int i = k + 1; i <= last_row; ++i) {
+      if (std::fabs(at(i, k)) > std::fabs(at(p, k))) p = i;
+    }
+    pivots[k] = p;
+    if (std::fabs(at(p, k)) <= tolerance) return false;
+    if (p != k) {
+      for (int j = k; j <= last_col; ++j) std::swap(at(k, j), at(p, j));
+      det = -det;
+    }
+    det *= at(k, k);
+    for (int i = k + 1; i <= last_row; ++i) {
+      double l = at(i, k) / at(k, k);
+      at(i, k) = l;
+      if (l == 0.0) continue;
+      for (int j = k + 1; j <= last_col; ++j) at(i, j) -= l * at(k, j);
+    }
+  }
+  return true;
+}
+
+S21Matrix S21BandedMatrix::Solve(const S21Matrix& b) const {
+  CheckRows(n_, b);
+  std::vector<double> lu;
+  std::vector<int> pivots;
+  double det = 0.0;
+  if (!Factorize(lu, pivots, det)) ThrowSingular();
+
+  int width = 2 * lower_ + upper_ + 1;
+  auto at = [&](int i, int j) {
+    return lu[1LL * i * width + (j - i + lower_)];
+  };
+  int cols = b.GetCols();
+  S21Matrix x(b);
+  // Перестановки применяются по ходу прямого хода, как в LAPACK gbtrs
+  for (int k = 0; k < n_; ++k) {
+    if (pivots[k] != k) {
+      std::swap_ranges(x.Row(k), x.Row(k) + cols, x.Row(pivots[k]));
+    }
+    int last = std::min(n_ - 1, k + lower_);
+    for (int i = k + 1; i <= last; ++i) {
+      Axpy(-at(i, k), x.Row(k), x.Row(i), cols);
+    }
+  }
+  for (int i = n_ - 1; i >= 0; --i) {
+    double* xi = x.Row(i);
+    int last = std::min(n_ - 1, i + upper_ + lower_);
+    for (int j = i + 1; j <= last; ++j) {
+      Axpy(-at(i, j), x.Row(j), xi, cols);
+    }
+    for (int j = 0; j < cols; ++j) xi[j] /= at(i, i);
+  }
+  return x;
+}
+
+double S21BandedMatrix::Determinant() const {
+  std::vector<double> lu;
+  std::vector<int> pivots;
+  double det = 0.0;
+  return Factorize(lu, pivots, det) ? det : 0.0;
+}
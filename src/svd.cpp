@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_parallel.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+// Блоки при проходах по большой A: блок узкой матрицы из kBlockCols
+// строк остаётся в кэше, пока по нему проходят строки A
+constexpr int kBlockRows = 64;
+constexpr int kBlockCols = 256;
+constexpr int kMaxSweeps = 60;
+
+// y += alpha * x
+void Axpy(double alpha, const double* x, double* y, int n) {
+  for (int j = 0; j < n; ++j) y[j] += alpha * x[j];
+}
+
+double Dot(const double* a, const double* b, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    s0 += a[j] * b[j];
+    s1 += a[j + 1] * b[j + 1];
+    s2 += a[j + 2] * b[j + 2];
+    s3 += a[j + 3] * b[j + 3];
+  }
+  for (; j < n; ++j) s0 += a[j] * b[j];
+  return (s0 + s1) + (s2 + s3);
+}
+
+// Указатели на строки собираются до параллельной части: Row отделяет
+// общий блок и не должен вызываться из нескольких потоков
+std::vector<double*> RowPointers(S21Matrix& m) {
+  std::vector<double*> rows(m.GetRows());
+  for (int i = 0; i < m.GetRows(); ++i) rows[i] = m.Row(i);
+  return rows;
+}
+
+// A Z за один проход по A: потоки берут полосы строк A
+S21Matrix MultiplyStreaming(const S21Matrix& a, const S21Matrix& z) {
+  int m = a.GetRows(), n = a.GetCols(), l = z.GetCols();
+  S21Matrix c(m, l);
+  std::vector<double*> out = RowPointers(c);
+  S21ParallelFor(0, m, kBlockRows, [&](int from, int to) {
+    for (int i0 = from; i0 < to; i0 += kBlockRows) {
+      int i1 = std::min(to, i0 + kBlockRows);
+      for (int p0 = 0; p0 < n; p0 += kBlockCols) {
+        int p1 = std::min(n, p0 + kBlockCols);
+        for (int i = i0; i < i1; ++i) {
+          const double* ai = a.Row(i);
+          for (int p = p0; p < p1; ++p) {
+            Axpy(ai[p], z.Row(p), out[i], l);
+          }
+        }
+      }
+    }
+  });
+  return c;
+}
+
+// A^T Q за один проход по A: потоки берут полосы столбцов A, и
+// соответствующие строки результата копятся в кэше
+S21Matrix TransposedStreaming(const S21Matrix& a, const S21Matrix& q) {
+  int m = a.GetRows(), n = a.GetCols(), l = q.GetCols();
+  S21Matrix c(n, l);
+  std::vector<double*> out = RowPointers(c);
+  S21ParallelFor(0, n, kBlockCols, [&](int from, int to) {
+    for (int j0 = from; j0 < to; j0 += kBlockCols) {
+      int j1 = std::min(to, j0 + kBlockCols);
+      for (int p = 0; p < m; ++p) {
+        const double* ap = a.Row(p);
+        const double* qp = q.Row(p);
+        for (int j = j0; j < j1; ++j) {
+          Axpy(ap[j], qp, out[j], l);
+        }
+      }
+    }
+  });
+  return c;
+}
+
+// Односторонний Якоби (Хестенс) по строкам g (l x l): вращения делают
+// строки попарно ортогональными, те же вращения копятся в строках w.
+// Тогда g^T = U diag(sigma) W^T, где строка i итоговой g равна
+// sigma_i u_i, а строка i итоговой w — столбец i матрицы W
+void JacobiRows(int l, std::vector<double>& g, std::vector<double>& w) {
+  const double eps = std::numeric_limits<double>::epsilon();
+  for (int sweep = 0; sweep < kMaxSweeps; ++sweep) {
+    bool rotated = false;
+    for (int p = 0; p < l; ++p) {
+      for (int q = p + 1; q < l; ++q) {
+        double* gp = g.data() + p * l;
+        double* gq = g.data() + q * l;
+        double alpha = Dot(gp, gp, l), beta = Dot(gq, gq, l);
+        double gamma = Dot(gp, gq, l);
+        if (std::fabs(gamma) <= eps * std::sqrt(alpha * beta)) continue;
+        rotated = true;
+        double zeta = (beta - alpha) / (2.0 * gamma);
+        double t = (zeta >= 0.0 ? 1.0 : -1.0) /
+                   (std::fabs(zeta) + std::sqrt(1.0 + zeta * zeta));
+        double c = 1.0 / std::sqrt(1.0 + t * t), s = c * t;
+        for (double* rows : {g.data(), w.data()}) {
+          double* xp = rows + p * l;
+          double* xq = rows + q * l;
+          for (int j = 0; j < l; ++j) {
+            double x = xp[j], y = xq[j];
+            xp[j] = c * x - s * y;
+            xq[j] = s * x + c * y;
+          }
+        }
+      }
+    }
+    if (!rotated) break;
+  }
+}
+
+}  // namespace
+
+S21QRResult S21Matrix::QR() const {
+  S21_TELEMETRY_SCOPE(S21Op::kQR, 1LL * rows_ * cols_);
+  int m = rows_, n = cols_, p = std::min(m, n);
+  S21Matrix a(*this);
+  a.Detach();
+  double** r = a.matrix_;
+  // Отражатель k: H = I - tau v v^T, v хранится в строках k..m-1
+  std::vector<double> v(static_cast<size_t>(m) * p, 0.0), tau(p, 0.0);
+  std::vector<double> w(n);
+
+  for (int k = 0; k < p; ++k) {
+    double norm2 = 0.0;
+    for (int i = k; i < m; ++i) norm2 += r[i][k] * r[i][k];
+    if (norm2 == 0.0) continue;
+    double alpha = r[k][k] >= 0.0 ? -std::sqrt(norm2) : std::sqrt(norm2);
+    double* vk = v.data() + static_cast<size_t>(k) * m;
+    for (int i = k; i < m; ++i) vk[i] = r[i][k];
+    vk[k] -= alpha;
+    tau[k] = 2.0 / (norm2 - r[k][k] * r[k][k] + vk[k] * vk[k]);
+
+    // w = v^T R и R -= tau v w по строкам, столбцы правее k
+    std::fill(w.begin() + k + 1, w.end(), 0.0);
+    for (int i = k; i < m; ++i) {
+      Axpy(vk[i], r[i] + k + 1, w.data() + k + 1, n - k - 1);
+    }
+    for (int i = k; i < m; ++i) {
+      Axpy(-tau[k] * vk[i], w.data() + k + 1, r[i] + k + 1, n - k - 1);
+    }
+    r[k][k] = alpha;
+    for (int i = k + 1; i < m; ++i) r[i][k] = 0.0;
+  }
+
+  S21QRResult result{S21Matrix(m, p), S21Matrix(p, n)};
+  for (int i = 0; i < p; ++i) {
+    std::copy(r[i] + i, r[i] + n, result.r.matrix_[i] + i);
+  }
+  // Q = H_0 ... H_{p-1} I_{m x p}, отражения применяются с конца
+  double** q = result.q.matrix_;
+  for (int i = 0; i < p; ++i) q[i][i] = 1.0;
+  for (int k = p - 1; k >= 0; --k) {
+    if (tau[k] == 0.0) continue;
+    const double* vk = v.data() + static_cast<size_t>(k) * m;
+    std::fill(w.begin(), w.begin() + p, 0.0);
+    for (int i = k; i < m; ++i) Axpy(vk[i], q[i] + k, w.data() + k, p - k);
+    for (int i = k; i < m; ++i) {
+      Axpy(-tau[k] * vk[i], w.data() + k, q[i] + k, p - k);
+    }
+  }
+  return result;
+}
+
+S21SvdResult S21Matrix::LowRank(int k,
+                                const S21LowRankOptions& options) const {
+  int m = rows_, n = cols_;
+  if (k < 1 || k > std::min(m, n)) {
+    throw std::invalid_argument("Rank must be in [1, min(rows, cols)]");
+  }
+  if (options.oversampling < 0 || options.power_iterations < 0) {
+    throw std::invalid_argument("Oversampling and power iterations must be "
+                                "non-negative");
+  }
+  int l = std::min(k + options.oversampling, std::min(m, n));
+  // Проходов по A: 2 + 2q
+  S21_TELEMETRY_SCOPE(S21Op::kLowRank, 1LL * m * n,
+                      8LL * m * n * (2 + 2 * options.power_iterations),
+                      2LL * m * n * l * (2 + 2 * options.power_iterations));
+
+  // Базис образа A Omega, уточнённый степенными итерациями (A A^T)^q;
+  // после каждого умножения базис снова ортонормируется
+  std::mt19937_64 rng(options.seed);
+  std::normal_distribution<double> normal;
+  S21Matrix omega(n, l);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < l; ++j) omega.matrix_[i][j] = normal(rng);
+  }
+  S21Matrix q = MultiplyStreaming(*this, omega).QR().q;
+  for (int it = 0; it < options.power_iterations; ++it) {
+    S21Matrix z = TransposedStreaming(*this, q).QR().q;
+    q = MultiplyStreaming(*this, z).QR().q;
+  }
+
+  // B = Q^T A; B^T = Q' R', и SVD малой R'^T даёт SVD B
+  S21QRResult bt = TransposedStreaming(*this, q).QR();
+  std::vector<double> g(static_cast<size_t>(l) * l), w(g.size(), 0.0);
+  for (int i = 0; i < l; ++i) {
+    std::copy(bt.r.matrix_[i], bt.r.matrix_[i] + l, g.begin() + i * l);
+    w[i * l + i] = 1.0;
+  }
+  JacobiRows(l, g, w);
+
+  std::vector<double> sigma(l);
+  for (int i = 0; i < l; ++i) {
+    sigma[i] = std::sqrt(Dot(g.data() + i * l, g.data() + i * l, l));
+  }
+  std::vector<int> order(l);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](int a, int b) { return sigma[a] > sigma[b]; });
+
+  // U = Q U_B, V^T = W^T Q'^T; нулевым сингулярным числам
+  // соответствуют нулевые столбцы U
+  S21Matrix ub(l, k), wt(k, l);
+  for (int j = 0; j < k; ++j) {
+    int s = order[j];
+    double scale = sigma[s] > 0.0 ? 1.0 / sigma[s] : 0.0;
+    for (int i = 0; i < l; ++i) ub.matrix_[i][j] = g[s * l + i] * scale;
+    std::copy(w.begin() + s * l, w.begin() + (s + 1) * l, wt.matrix_[j]);
+  }
+  S21SvdResult result{S21Matrix(m, k), S21Vector(k), S21Matrix(k, n)};
+  result.u.Gemm(1.0, q, ub, 0.0);
+  result.vt.Gemm(1.0, wt, bt.q, 0.0, false, true);
+  for (int j = 0; j < k; ++j) result.sigma(j) = sigma[order[j]];
+  return result;
+}
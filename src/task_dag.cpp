@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include "s21_executor.h"
+#include "s21_numa.h"
+#include "s21_parallel.h"
+#include "s21_task_dag.h"
+
+namespace {
+
+// Очередь одного участника: владелец работает с концом, воры — с началом
+struct WorkQueue {
+  std::mutex mutex;
+  std::deque<int> tasks;
+};
+
+}  // namespace
+
+S21TaskDag::Task S21TaskDag::Add(std::function<void()> body,
+                                 const std::vector<int>& reads,
+                                 const std::vector<int>& writes,
+                                 bool critical) {
+  Task id = static_cast<Task>(tasks_.size());
+  std::vector<Task> depends;
+  auto block = [&](int b) -> BlockState& {
+    if (b < 0) throw std::out_of_range("Block numbers must be non-negative");
+    if (b >= static_cast<int>(blocks_.size())) blocks_.resize(b + 1);
+    return blocks_[b];
+  };
+  for (int b : reads) {
+    if (block(b).writer >= 0) depends.push_back(blocks_[b].writer);
+  }
+  for (int b : writes) {
+    BlockState& state = block(b);
+    if (state.writer >= 0) depends.push_back(state.writer);
+    depends.insert(depends.end(), state.readers.begin(), state.readers.end());
+  }
+  std::sort(depends.begin(), depends.end());
+  depends.erase(std::unique(depends.begin(), depends.end()), depends.end());
+
+  for (int b : reads) blocks_[b].readers.push_back(id);
+  for (int b : writes) {
+    blocks_[b].writer = id;
+    blocks_[b].readers.clear();
+  }
+  TaskData data;
+  data.body = std::move(body);
+  data.dependencies = static_cast<int>(depends.size());
+  data.critical = critical;
+  for (Task d : depends) tasks_[d].successors.push_back(id);
+  tasks_.push_back(std::move(data));
+  return id;
+}
+
+void S21TaskDag::Run() {
+  std::vector<TaskData> tasks;
+  tasks.swap(tasks_);
+  blocks_.clear();
+  int count = static_cast<int>(tasks.size());
+  if (count == 0) return;
+
+  int participants = std::min(S21ThreadCount(),
+                              S21Executor::Instance().WorkerCount() + 1);
+  if (participants <= 1 || S21Executor::InWorker()) {
+    // Зависимости ведут только к ранним задачам, поэтому порядок
+    // добавления — допустимый последовательный порядок
+    for (TaskData& task : tasks) task.body();
+    return;
+  }
+
+  // Всё, что нужно участникам, живёт в общем состоянии: задача пула,
+  // запущенная после завершения графа, просто ничего не найдёт
+  struct State {
+    std::vector<TaskData> tasks;
+    std::unique_ptr<std::atomic<int>[]> pending;
+    std::vector<WorkQueue> queues;
+    WorkQueue critical;
+    std::atomic<int> ready{0}, remaining{0};
+    std::atomic<bool> failed{false};
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::exception_ptr error;
+  };
+  auto state = std::make_shared<State>();
+  state->tasks = std::move(tasks);
+  state->pending.reset(new std::atomic<int>[count]);
+  state->queues = std::vector<WorkQueue>(participants);
+  state->remaining = count;
+
+  auto push = [](State& s, int self, int task) {
+    WorkQueue& queue = s.tasks[task].critical ? s.critical : s.queues[self];
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(task);
+    }
+    s.ready.fetch_add(1);
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.cv.notify_one();
+  };
+  auto take = [](State& s, int self) {
+    int task = -1;
+    auto pop = [&](WorkQueue& queue, bool back) {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) return false;
+      task = back ? queue.tasks.back() : queue.tasks.front();
+      if (back) {
+        queue.tasks.pop_back();
+      } else {
+        queue.tasks.pop_front();
+      }
+      return true;
+    };
+    int size = static_cast<int>(s.queues.size());
+    bool found = pop(s.critical, false) || pop(s.queues[self], true);
+    for (int k = 1; !found && k < size; ++k) {
+      found = pop(s.queues[(self + k) % size], false);
+    }
+    if (found) s.ready.fetch_sub(1);
+    return task;
+  };
+
+  for (int t = 0; t < count; ++t) {
+    state->pending[t] = state->tasks[t].dependencies;
+  }
+  // Начальные задачи раскладываются по очередям по кругу
+  for (int t = 0, next = 0; t < count; ++t) {
+    if (state->tasks[t].dependencies == 0) {
+      push(*state, next, t);
+      next = (next + 1) % participants;
+    }
+  }
+
+  auto run = [state, push, take](int self) {
+    State& s = *state;
+    while (s.remaining.load() > 0) {
+      int task = take(s, self);
+      if (task < 0) {
+        std::unique_lock<std::mutex> lock(s.mutex);
+        s.cv.wait(lock, [&] {
+          return s.ready.load() > 0 || s.remaining.load() == 0;
+        });
+        continue;
+      }
+      if (!s.failed.load()) {
+        try {
+          s.tasks[task].body();
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(s.mutex);
+          if (!s.error) s.error = std::current_exception();
+          s.failed = true;
+        }
+      }
+      for (int next : s.tasks[task].successors) {
+        if (s.pending[next].fetch_sub(1) == 1) push(s, self, next);
+      }
+      if (s.remaining.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.cv.notify_all();
+      }
+    }
+  };
+
+  S21Executor& executor = S21Executor::Instance();
+  bool pinned = S21Numa::IsPinned();
+  for (int i = 1; i < participants; ++i) {
+    auto helper = [run, i] { run(i); };
+    if (pinned) {
+      executor.SubmitTo(i - 1, helper);
+    } else {
+      executor.Submit(helper);
+    }
+  }
+  run(0);
+  if (state->error) std::rethrow_exception(state->error);
+}
@@ -0,0 +1,159 @@
+#include "s21_task_graph.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
+#include "s21_executor.h"
+
+void S21TaskGraph::CheckNode(Node node) const {
+  if (node < 0 || node >= static_cast<int>(nodes_.size())) {
+    throw std::out_of_range("Unknown task graph node");
+  }
+}
+
+S21TaskGraph::Node S21TaskGraph::AddInput(S21Matrix value) {
+  NodeData data;
+  data.is_input = true;
+  data.value = std::make_unique<S21Matrix>(std::move(value));
+  nodes_.push_back(std::move(data));
+  return static_cast<Node>(nodes_.size()) - 1;
+}
+
+S21TaskGraph::Node S21TaskGraph::AddNode(Operation operation,
+                                         std::vector<Node> inputs) {
+  Node id = static_cast<Node>(nodes_.size());
+  for (Node input : inputs) CheckNode(input);
+  for (Node input : inputs) nodes_[input].consumers.push_back(id);
+  NodeData data;
+  data.operation = std::move(operation);
+  data.inputs = std::move(inputs);
+  nodes_.push_back(std::move(data));
+  return id;
+}
+
+S21TaskGraph::Node S21TaskGraph::Sum(Node a, Node b) {
+  return AddNode([](const auto& in) { return *in[0] + *in[1]; }, {a, b});
+}
+
+S21TaskGraph::Node S21TaskGraph::Sub(Node a, Node b) {
+  return AddNode([](const auto& in) { return *in[0] - *in[1]; }, {a, b});
+}
+
+S21TaskGraph::Node S21TaskGraph::Mul(Node a, Node b) {
+  return AddNode([](const auto& in) { return *in[0] * *in[1]; }, {a, b});
+}
+
+S21TaskGraph::Node S21TaskGraph::Transpose(Node a) {
+  return AddNode([](const auto& in) { return in[0]->Transpose(); }, {a});
+}
+
+S21TaskGraph::Node S21TaskGraph::Inverse(Node a) {
+  // Потребители одного входа работают одновременно, а InverseMatrix
+  // заполняет кэш разложения; копия разделяет блок, но кэш у неё свой
+  return AddNode(
+      [](const auto& in) {
+        S21Matrix copy(*in[0]);
+        return copy.InverseMatrix();
+      },
+      {a});
+}
+
+void S21TaskGraph::KeepResult(Node node) {
+  CheckNode(node);
+  nodes_[node].keep = true;
+}
+
+const S21Matrix& S21TaskGraph::Result(Node node) const {
+  CheckNode(node);
+  if (!nodes_[node].value) {
+    throw std::logic_error("Node result is not available");
+  }
+  return *nodes_[node].value;
+}
+
+void S21TaskGraph::Run() {
+  int count = static_cast<int>(nodes_.size());
+  // pending: сколько входов узла ещё не готово;
+  // readers: сколько потребителей ещё не прочитали результат
+  std::vector<std::atomic<int>> pending(count), readers(count);
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::exception_ptr error;
+  int running = 0;
+  bool failed = false;
+
+  std::vector<Node> ready;
+  for (Node i = 0; i < count; ++i) {
+    if (!nodes_[i].is_input) nodes_[i].value.reset();
+    pending[i] = static_cast<int>(nodes_[i].inputs.size());
+    readers[i] = static_cast<int>(nodes_[i].consumers.size());
+    if (pending[i] == 0) ready.push_back(i);
+  }
+
+  std::function<void(Node)> execute;
+  auto release = [&](Node node) {
+    NodeData& data = nodes_[node];
+    if (--readers[node] == 0 && !data.keep && !data.is_input) {
+      data.value.reset();
+    }
+  };
+  // Выполняет узел и возвращает потребителей, ставших готовыми
+  auto finish = [&](Node node) {
+    NodeData& data = nodes_[node];
+    if (!data.is_input) {
+      std::vector<const S21Matrix*> inputs;
+      for (Node input : data.inputs) {
+        inputs.push_back(nodes_[input].value.get());
+      }
+      data.value = std::make_unique<S21Matrix>(data.operation(inputs));
+      for (Node input : data.inputs) release(input);
+    }
+    std::vector<Node> next;
+    for (Node consumer : data.consumers) {
+      if (--pending[consumer] == 0) next.push_back(consumer);
+    }
+    return next;
+  };
+
+  if (S21Executor::InWorker()) {
+    // Внутри пула ожидание может занять последний рабочий поток,
+    // поэтому граф выполняется последовательно на текущем потоке
+    std::vector<Node> stack(ready);
+    while (!stack.empty()) {
+      Node node = stack.back();
+      stack.pop_back();
+      for (Node next : finish(node)) stack.push_back(next);
+    }
+    return;
+  }
+
+  S21Executor& executor = S21Executor::Instance();
+  execute = [&](Node node) {
+    std::vector<Node> next;
+    try {
+      next = finish(node);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!error) error = std::current_exception();
+      failed = true;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!failed) {
+      for (Node n : next) {
+        ++running;
+        executor.Submit([&execute, n] { execute(n); });
+      }
+    }
+    if (--running == 0) cv.notify_all();
+  };
+
+  std::unique_lock<std::mutex> lock(mutex);
+  for (Node node : ready) {
+    ++running;
+    executor.Submit([&execute, node] { execute(node); });
+  }
+  cv.wait(lock, [&] { return running == 0; });
+  if (error) std::rethrow_exception(error);
+}
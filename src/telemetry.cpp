@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+
+#include "s21_numa.h"
+#include "s21_telemetry.h"
+
+namespace {
+
+constexpr int kOpCount = static_cast<int>(S21Op::kCount);
+
+const char* const kOpNames[kOpCount] = {
+    "CreateMatrix", "Copy",          "Move",            "Assign",
+    "SumMatrix",    "SubMatrix",     "MulNumber",       "MulMatrix",
+    "Gemm",         "Gemv",          "Transpose",       "CalcComplements",
+    "Determinant",  "InverseMatrix", "Solve",           "Rank",
+    "Compare",      "SolveRefined",  "MulChain",        "Eigen",
+    "Pow",          "Hadamard",      "Kronecker",       "Reduce",
+    "LowRankUpdate", "ExactDeterminant", "ExactRank",   "QR",
+    "LowRank",       "Adopt"};
+
+struct Counters {
+  std::atomic<std::uint64_t> calls{0}, total_ns{0}, max_ns{0}, elements{0},
+      bytes{0};
+};
+
+// Счётчики одного потока: пишет только владелец, читает снимок.
+// Reset не трогает чужие счётчики, а увеличивает g_generation: владелец
+// сам обнуляет их при следующей записи, а до того снимок их пропускает
+struct ThreadCounters {
+  Counters ops[kOpCount];
+  std::atomic<std::uint64_t> generation;
+  ThreadCounters();
+  ~ThreadCounters();
+};
+
+std::atomic<bool> g_enabled{false};
+std::atomic<std::uint64_t> g_generation{0};
+
+// Счётчики потока относятся к текущему поколению, а не к сброшенному
+bool IsCurrent(const ThreadCounters& thread) {
+  return thread.generation.load(std::memory_order_acquire) ==
+         g_generation.load(std::memory_order_relaxed);
+}
+
+// Реестр живых потоков и сумма по уже завершившимся
+struct Registry {
+  std::mutex mutex;
+  std::vector<ThreadCounters*> threads;
+  S21OpStats retired[kOpCount] = {};
+};
+
+Registry& GetRegistry() {
+  static Registry* registry = new Registry();  // живёт до конца процесса
+  return *registry;
+}
+
+void Accumulate(S21OpStats& to, const Counters& from) {
+  to.calls += from.calls.load(std::memory_order_relaxed);
+  to.total_ns += from.total_ns.load(std::memory_order_relaxed);
+  to.max_ns = std::max<std::uint64_t>(
+      to.max_ns, from.max_ns.load(std::memory_order_relaxed));
+  to.elements += from.elements.load(std::memory_order_relaxed);
+  to.bytes += from.bytes.load(std::memory_order_relaxed);
+}
+
+ThreadCounters::ThreadCounters() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  generation.store(g_generation.load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+  registry.threads.push_back(this);
+}
+
+ThreadCounters::~ThreadCounters() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  if (IsCurrent(*this)) {
+    for (int i = 0; i < kOpCount; ++i) {
+      Accumulate(registry.retired[i], ops[i]);
+    }
+  }
+  registry.threads.erase(
+      std::find(registry.threads.begin(), registry.threads.end(), this));
+}
+
+void Add(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+  // Единственный писатель: load + store дешевле атомарного fetch_add
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
+}  // namespace
+
+void S21Telemetry::SetEnabled(bool enabled) {
+  g_enabled.store(enabled && kCompiled, std::memory_order_relaxed);
+}
+
+bool S21Telemetry::IsEnabled() {
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void S21Telemetry::Reset() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  S21Numa::ResetCounters();
+  for (int i = 0; i < kOpCount; ++i) registry.retired[i] = S21OpStats{};
+  g_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+const char* S21Telemetry::OpName(S21Op op) {
+  return kOpNames[static_cast<int>(op)];
+}
+
+std::vector<S21OpStats> S21Telemetry::Snapshot() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::vector<S21OpStats> result(registry.retired, registry.retired + kOpCount);
+  for (ThreadCounters* thread : registry.threads) {
+    if (!IsCurrent(*thread)) continue;
+    for (int i = 0; i < kOpCount; ++i) Accumulate(result[i], thread->ops[i]);
+  }
+  for (int i = 0; i < kOpCount; ++i) result[i].name = kOpNames[i];
+  return result;
+}
+
+std::string S21Telemetry::Dump() {
+  std::ostringstream out;
+  for (const S21OpStats& s : Snapshot()) {
+    if (s.calls == 0) continue;
+    const char* labels[] = {"calls", "time_ns_total", "time_ns_max",
+                            "elements_total", "bytes_total"};
+    std::uint64_t values[] = {s.calls, s.total_ns, s.max_ns, s.elements,
+                              s.bytes};
+    for (int k = 0; k < 5; ++k) {
+      out << "s21_matrix_" << labels[k] << "{op=\"" << s.name << "\"} "
+          << values[k] << '\n';
+    }
+  }
+  out << S21Numa::Dump();
+  return out.str();
+}
+
+void S21Telemetry::Record(S21Op op, std::uint64_t ns, std::uint64_t elements,
+                          std::uint64_t bytes) {
+  thread_local ThreadCounters counters;
+  std::uint64_t generation = g_generation.load(std::memory_order_relaxed);
+  if (counters.generation.load(std::memory_order_relaxed) != generation) {
+    for (Counters& stale : counters.ops) {
+      for (auto* counter : {&stale.calls, &stale.total_ns, &stale.max_ns,
+                            &stale.elements, &stale.bytes}) {
+        counter->store(0, std::memory_order_relaxed);
+      }
+    }
+    // Снимок увидит обнулённые счётчики раньше нового поколения
+    counters.generation.store(generation, std::memory_order_release);
+  }
+  Counters& c = counters.ops[static_cast<int>(op)];
+  Add(c.calls, 1);
+  Add(c.total_ns, ns);
+  Add(c.elements, elements);
+  Add(c.bytes, bytes);
+  if (ns > c.max_ns.load(std::memory_order_relaxed)) {
+    c.max_ns.store(ns, std::memory_order_relaxed);
+  }
+}
+
+S21TelemetryScope::S21TelemetryScope(S21Op op, long long elements,
+                                     long long traffic, long long flops,
+                                     long long allocated)
+    : op_(op),
+      active_(S21Telemetry::IsEnabled()),
+      perf_(S21Perf::IsEnabled()),
+      elements_(elements),
+      traffic_(traffic),
+      flops_(flops),
+      allocated_(allocated) {
+  if (active_ || perf_) start_ = std::chrono::steady_clock::now();
+  if (perf_) S21Perf::Read(perf_start_);
+}
+
+S21TelemetryScope::~S21TelemetryScope() {
+  if (!active_ && !perf_) return;
+  S21PerfSample perf_end;
+  if (perf_) S21Perf::Read(perf_end);
+  auto elapsed = std::chrono::steady_clock::now() - start_;
+  std::uint64_t ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  if (active_) S21Telemetry::Record(op_, ns, elements_, allocated_);
+  if (perf_) {
+    S21Perf::Record(op_, ns, elements_, flops_, traffic_, perf_start_,
+                    perf_end);
+  }
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cmath>
+
+#include "../../s21_distributed.h"
+
+// Тесты коллективны: каждый выполняется всеми процессами
+// (mpiexec -np 4 ./run_mpi_tests), проверки — на процессе 0
+
+static S21Matrix MakeMatrix(int rows, int cols, double shift) {
+  S21Matrix M(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      M(i, j) = std::sin(0.37 * i + 0.11 * j + shift) + (i == j ? 4.0 : 0.0);
+    }
+  }
+  return M;
+}
+
+TEST(DistributedTest, ScatterGather) {
+  S21ProcessGrid grid;
+  S21Matrix A = MakeMatrix(37, 29, 0.0);
+  auto D = S21DistributedMatrix::Scatter(grid, A, 37, 29, 4);
+  for (int i = 0; i < D.Local().GetRows(); ++i) {
+    for (int j = 0; j < D.Local().GetCols(); ++j) {
+      EXPECT_DOUBLE_EQ(D.Local()(i, j), A(D.GlobalRow(i), D.GlobalCol(j)));
+    }
+  }
+  S21Matrix B = D.Gather();
+  if (grid.Rank() == 0) {
+    EXPECT_TRUE(B.EqMatrix(A));
+  }
+
+  EXPECT_THROW(S21DistributedMatrix(grid, 3, 3, 0), std::invalid_argument);
+  if (grid.Size() > 1) {
+    // Один блок на всю матрицу: части процессов нечего хранить
+    EXPECT_THROW(S21DistributedMatrix(grid, 3, 3, 4), std::invalid_argument);
+  }
+  EXPECT_THROW(S21DistributedMatrix::Scatter(grid, A, 36, 29, 4),
+               std::logic_error);
+}
+
+TEST(DistributedTest, Multiply) {
+  S21ProcessGrid grid;
+  S21Matrix A = MakeMatrix(45, 38, 0.5);
+  S21Matrix B = MakeMatrix(38, 51, 1.5);
+  auto da = S21DistributedMatrix::Scatter(grid, A, 45, 38, 5);
+  auto db = S21DistributedMatrix::Scatter(grid, B, 38, 51, 5);
+  S21Matrix C = S21DistributedMatrix::Multiply(da, db).Gather();
+  if (grid.Rank() == 0) {
+    S21Comparison cmp = C.Compare(A * B, 1e-12, S21Tolerance::kRelative);
+    EXPECT_TRUE(cmp.equal) << cmp.max_deviation;
+  }
+
+  auto dc = S21DistributedMatrix::Scatter(grid, A, 45, 38, 3);
+  EXPECT_THROW(S21DistributedMatrix::Multiply(da, dc), std::logic_error);
+  EXPECT_THROW(S21DistributedMatrix::Multiply(da, da), std::logic_error);
+}
+
+TEST(DistributedTest, LU) {
+  S21ProcessGrid grid;
+  const int n = 50;
+  S21Matrix A = MakeMatrix(n, n, 2.0);
+  // Малая диагональ в начале заставляет переставлять строки
+  A(0, 0) = 1e-3;
+  auto lu = S21DistributedMatrix::Scatter(grid, A, n, n, 4).LU();
+  S21Matrix F = lu.factors.Gather();
+  EXPECT_FALSE(lu.singular);
+  if (grid.Rank() == 0) {
+    S21Matrix L(n, n), U(n, n), PA(A);
+    for (int i = 0; i < n; ++i) {
+      L(i, i) = 1.0;
+      for (int j = 0; j < n; ++j) (j < i ? L(i, j) : U(i, j)) = F(i, j);
+    }
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) std::swap(PA(i, j), PA(lu.pivots[i], j));
+    }
+    EXPECT_NE(lu.pivots[0], 0);
+    EXPECT_TRUE((L * U).Compare(PA, 1e-12, S21Tolerance::kRelative).equal);
+    EXPECT_NEAR(lu.determinant / A.Determinant(), 1.0, 1e-10);
+  }
+
+  S21Matrix Z = MakeMatrix(n, n, 0.0);
+  for (int j = 0; j < n; ++j) Z(7, j) = 2.0 * Z(3, j);
+  auto singular = S21DistributedMatrix::Scatter(grid, Z, n, n, 4).LU();
+  EXPECT_EQ(singular.determinant, 0.0);
+}
+
+int main(int argc, char** argv) {
+  MPI_Init(&argc, &argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  if (rank != 0) {
+    auto& listeners = ::testing::UnitTest::GetInstance()->listeners();
+    delete listeners.Release(listeners.default_result_printer());
+  }
+  int failed = RUN_ALL_TESTS();
+  MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Finalize();
+  return failed;
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "../s21_executor.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_parallel.h"
+#include "../s21_task_graph.h"
+#include "test_helpers.h"
+
+static S21Matrix DiagonalWithRamp(int rows, int cols, double shift) {
+  return FillMatrix(rows, cols, [shift](int i, int j) {
+    return (i == j ? 5.0 : 0.0) + shift * j;
+  });
+}
+
+TEST(ParallelForTest, CoversRangeOnce) {
+  std::vector<std::atomic<int>> hits(1000);
+  S21ParallelFor(0, 1000, 7, [&](int from, int to) {
+    for (int i = from; i < to; ++i) ++hits[i];
+  });
+
+  for (const auto& h : hits) EXPECT_EQ(h.load(), 1);
+}
+
+TEST(ParallelForTest, PropagatesException) {
+  EXPECT_THROW(S21ParallelFor(0, 100, 1,
+                              [](int, int) { throw std::runtime_error("x"); }),
+               std::runtime_error);
+}
+
+TEST(AsyncTest, IndependentProducts) {
+  S21Matrix A = DiagonalWithRamp(4, 4, 1.0);
+  S21Matrix B = DiagonalWithRamp(4, 4, 2.0);
+
+  std::future<S21Matrix> ab = A.MulMatrixAsync(B);
+  std::future<S21Matrix> sum = A.SumMatrixAsync(B);
+  std::future<S21Matrix> sub = A.SubMatrixAsync(B);
+  std::future<double> det = A.DeterminantAsync();
+  A(0, 0) = 100.0;  // операнды уже скопированы
+
+  S21Matrix expected = DiagonalWithRamp(4, 4, 1.0) * B;
+  EXPECT_TRUE(ab.get().EqMatrix(expected));
+  EXPECT_DOUBLE_EQ(sum.get()(0, 0), 5.0 + 5.0);
+  EXPECT_DOUBLE_EQ(sub.get()(0, 0), 0.0);
+  EXPECT_NEAR(det.get(), DiagonalWithRamp(4, 4, 1.0).Determinant(), 1e-9);
+}
+
+TEST(AsyncTest, InverseAndSolve) {
+  S21Matrix A = DiagonalWithRamp(3, 3, 1.0);
+  S21Matrix b(3, 1);
+  b(2, 0) = 1.0;
+
+  S21Matrix inv = A.InverseAsync().get();
+  S21Matrix x = A.SolveAsync(b).get();
+
+  EXPECT_TRUE((A * x).EqMatrix(b));
+  EXPECT_TRUE((A * inv).EqMatrix(DiagonalWithRamp(3, 3, 0.0) * 0.2));
+}
+
+TEST(AsyncTest, ExceptionInFuture) {
+  S21Matrix singular(2, 2);
+
+  std::future<S21Matrix> inv = singular.InverseAsync();
+
+  EXPECT_THROW(inv.get(), std::logic_error);
+}
+
+TEST(TaskGraphTest, DiamondGraph) {
+  S21TaskGraph graph;
+  auto a = graph.AddInput(DiagonalWithRamp(3, 3, 1.0));
+  auto b = graph.AddInput(DiagonalWithRamp(3, 3, 2.0));
+  auto ab = graph.Mul(a, b);
+  auto ba = graph.Mul(b, a);
+  auto t = graph.Transpose(ab);
+  auto sum = graph.Sum(t, ba);
+  graph.KeepResult(ab);
+
+  graph.Run();
+
+  S21Matrix A = DiagonalWithRamp(3, 3, 1.0);
+  S21Matrix B = DiagonalWithRamp(3, 3, 2.0);
+  EXPECT_TRUE(graph.Result(sum).EqMatrix((A * B).Transpose() + B * A));
+  EXPECT_TRUE(graph.Result(ab).EqMatrix(A * B));
+  EXPECT_THROW(graph.Result(ba), std::logic_error);  // промежуточный узел
+  EXPECT_NO_THROW(graph.Result(a));
+}
+
+TEST(TaskGraphTest, CustomNodeAndRerun) {
+  S21TaskGraph graph;
+  auto a = graph.AddInput(DiagonalWithRamp(2, 2, 0.0));
+  auto scaled = graph.AddNode(
+      [](const std::vector<const S21Matrix*>& in) { return *in[0] * 3.0; },
+      {a});
+  auto inv = graph.Inverse(scaled);
+
+  graph.Run();
+  graph.Run();
+
+  EXPECT_NEAR(graph.Result(inv)(1, 1), 1.0 / 15.0, 1e-12);
+}
+
+TEST(TaskGraphTest, ConsumersShareInput) {
+  S21TaskGraph graph;
+  S21Matrix A = DiagonalWithRamp(3, 3, 0.0) * 5.0;
+  auto a = graph.AddInput(A);
+  std::vector<S21TaskGraph::Node> inverses;
+  for (int k = 0; k < 4; ++k) inverses.push_back(graph.Inverse(a));
+  for (auto node : inverses) graph.KeepResult(node);
+
+  graph.Run();
+
+  S21Matrix expected = A.InverseMatrix();
+  for (auto node : inverses) {
+    EXPECT_TRUE(graph.Result(node).EqMatrix(expected));
+  }
+}
+
+TEST(TaskGraphTest, ErrorPropagates) {
+  S21TaskGraph graph;
+  auto a = graph.AddInput(S21Matrix(2, 3));
+  auto b = graph.AddInput(S21Matrix(2, 3));
+  auto bad = graph.Mul(a, b);
+  graph.Sum(bad, a);
+
+  EXPECT_THROW(graph.Run(), std::logic_error);
+  EXPECT_THROW(graph.AddNode(nullptr, {42}), std::out_of_range);
+}
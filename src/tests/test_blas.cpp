@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "../s21_matrix_oop.h"
+#include "test_helpers.h"
+
+TEST(GemvTest, MulVector) {
+  S21Matrix A = LinearMatrix(2, 3);
+  S21Vector x(3);
+  x(0) = 1;
+  x(1) = 2;
+  x(2) = 3;
+
+  S21Vector y = A.MulVector(x);
+
+  EXPECT_EQ(y.GetSize(), 2);
+  EXPECT_DOUBLE_EQ(y(0), 0.5 * 1 - 0.5 * 2 - 1.5 * 3);
+  EXPECT_DOUBLE_EQ(y(1), 1.0 * 1 + 0.0 * 2 - 1.0 * 3);
+}
+
+TEST(GemvTest, MulVectorTransposed) {
+  S21Matrix A = LinearMatrix(2, 3);
+  S21Vector x(2);
+  x(0) = 2;
+  x(1) = -1;
+
+  S21Vector y = A.MulVectorTransposed(x);
+  S21Matrix T = A.Transpose();
+  S21Vector expected = T.MulVector(x);
+
+  EXPECT_EQ(y.GetSize(), 3);
+  EXPECT_TRUE(y.EqVector(expected));
+}
+
+TEST(GemvTest, AlphaBeta) {
+  S21Matrix A = LinearMatrix(3, 3);
+  S21Vector x(3);
+  x.Fill(1.0);
+  S21Vector y(3);
+  y.Fill(10.0);
+  S21Vector ax = A.MulVector(x);
+
+  A.Gemv(2.0, x, 0.5, y);
+
+  for (int i = 0; i < 3; ++i) EXPECT_DOUBLE_EQ(y(i), 2.0 * ax(i) + 5.0);
+}
+
+TEST(GemvTest, LargeMatchesMulMatrix) {
+  S21Matrix A = LinearMatrix(300, 257);
+  S21Matrix xm(257, 1);
+  S21Vector x(257);
+  for (int i = 0; i < 257; ++i) x(i) = xm(i, 0) = 1.0 / (i + 1);
+
+  S21Vector y = A.MulVector(x);
+  S21Matrix ym = A * xm;
+
+  for (int i = 0; i < 300; ++i) EXPECT_NEAR(y(i), ym(i, 0), 1e-9);
+}
+
+TEST(GemvTest, TransposedIsReproducible) {
+  // Много блоков строк: частичные суммы складываются в порядке блоков,
+  // а не в порядке завершения потоков
+  S21Matrix A = RandomMatrix(4000, 64);
+  S21Vector x(4000);
+  for (int i = 0; i < 4000; ++i) x(i) = std::sin(i * 0.37);
+
+  S21Vector first = A.MulVectorTransposed(x);
+  S21Vector expected = A.Transpose().MulVector(x);
+  for (int j = 0; j < 64; ++j) EXPECT_NEAR(first(j), expected(j), 1e-10);
+  for (int run = 0; run < 20; ++run) {
+    S21Vector again = A.MulVectorTransposed(x);
+    for (int j = 0; j < 64; ++j) ASSERT_EQ(again(j), first(j));
+  }
+}
+
+TEST(GemvTest, WrongSize) {
+  S21Matrix A = LinearMatrix(2, 3);
+  S21Vector x(2);
+
+  EXPECT_THROW(A.MulVector(x), std::logic_error);
+  EXPECT_NO_THROW(A.MulVectorTransposed(x));
+}
+
+TEST(GemmTest, MatchesOperator) {
+  S21Matrix A = LinearMatrix(4, 3);
+  S21Matrix B = LinearMatrix(3, 5);
+  S21Matrix C(4, 5);
+
+  C.Gemm(1.0, A, B, 0.0);
+
+  EXPECT_TRUE(C.EqMatrix(A * B));
+}
+
+TEST(GemmTest, AccumulateWithScaling) {
+  S21Matrix A = LinearMatrix(3, 3);
+  S21Matrix B = LinearMatrix(3, 3);
+  S21Matrix C = LinearMatrix(3, 3);
+  S21Matrix expected = A * B * 2.0 + C * 0.5;
+
+  C.Gemm(2.0, A, B, 0.5);
+
+  EXPECT_TRUE(C.EqMatrix(expected));
+}
+
+TEST(GemmTest, TransposeFlags) {
+  S21Matrix A = LinearMatrix(3, 4);
+  S21Matrix B = LinearMatrix(5, 3);
+  S21Matrix At = A.Transpose();
+  S21Matrix Bt = B.Transpose();
+
+  S21Matrix C1(4, 5);
+  C1.Gemm(1.0, A, Bt, 0.0, true, false);
+  S21Matrix C2(4, 5);
+  C2.Gemm(1.0, At, B, 0.0, false, true);
+  S21Matrix C3(4, 5);
+  C3.Gemm(1.0, A, B, 0.0, true, true);
+
+  S21Matrix expected = At * Bt;
+  EXPECT_TRUE(C1.EqMatrix(expected));
+  EXPECT_TRUE(C2.EqMatrix(expected));
+  EXPECT_TRUE(C3.EqMatrix(expected));
+}
+
+TEST(GemmTest, AliasedOperand) {
+  S21Matrix C = LinearMatrix(3, 3);
+  S21Matrix expected = C * C + C;
+
+  C.Gemm(1.0, C, C, 1.0);
+
+  EXPECT_TRUE(C.EqMatrix(expected));
+}
+
+TEST(GemmTest, ZeroTimesInfinity) {
+  const double inf = std::numeric_limits<double>::infinity();
+  S21Matrix A(1, 1), B(1, 1);
+  B(0, 0) = inf;
+
+  EXPECT_TRUE(std::isnan((A * B)(0, 0)));
+  S21Matrix C(1, 1);
+  C.Gemm(1.0, A, B, 0.0);
+  EXPECT_TRUE(std::isnan(C(0, 0)));
+  B(0, 0) = std::numeric_limits<double>::quiet_NaN();
+  A.MulMatrix(B);
+  EXPECT_TRUE(std::isnan(A(0, 0)));
+}
+
+TEST(GemmTest, WrongDimensions) {
+  S21Matrix A = LinearMatrix(3, 4);
+  S21Matrix B = LinearMatrix(3, 4);
+  S21Matrix C(3, 3);
+
+  EXPECT_THROW(C.Gemm(1.0, A, B, 0.0), std::logic_error);
+  EXPECT_THROW(C.Gemm(1.0, A, B, 0.0, true, false), std::logic_error);
+  EXPECT_NO_THROW(C.Gemm(1.0, A, B, 0.0, false, true));
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include "../s21_matrix_oop.h"
+#include "test_helpers.h"
+
+static S21Matrix ModuloMatrix(int rows, int cols) {
+  return FillMatrix(rows, cols, [](int i, int j) {
+    return ((i * 7 + j * 3) % 11) / 10.0;
+  });
+}
+
+TEST(MulChainTest, MatchesLeftToRight) {
+  S21Matrix A = ModuloMatrix(30, 4);
+  S21Matrix B = ModuloMatrix(4, 25);
+  S21Matrix C = ModuloMatrix(25, 3);
+  S21Matrix D = ModuloMatrix(3, 20);
+
+  S21Matrix result = S21Matrix::MulChain({&A, &B, &C, &D});
+  S21Matrix expected = A * B * C * D;
+
+  EXPECT_EQ(result.GetRows(), 30);
+  EXPECT_EQ(result.GetCols(), 20);
+  EXPECT_TRUE(result.Compare(expected, 1e-9).equal);
+}
+
+TEST(MulChainTest, ChoosesCheapOrder) {
+  // (A B) C: 10^7 + 10^7 умножений, A (B C): 10^5 + 10^5
+  S21ChainPlan plan = S21Matrix::PlanChain({1000, 10, 1000, 10});
+  EXPECT_EQ(plan.order, "(0 (1 2))");
+  EXPECT_DOUBLE_EQ(plan.multiplications, 2e5);
+
+  plan = S21Matrix::PlanChain({10, 1000, 10, 1000});
+  EXPECT_EQ(plan.order, "((0 1) 2)");
+  EXPECT_DOUBLE_EQ(plan.multiplications, 2e5);
+
+  // Классический пример CLRS: 15125 умножений
+  plan = S21Matrix::PlanChain({30, 35, 15, 5, 10, 20, 25});
+  EXPECT_EQ(plan.order, "((0 (1 2)) ((3 4) 5))");
+  EXPECT_DOUBLE_EQ(plan.multiplications, 15125.0);
+  EXPECT_EQ(S21Matrix::PlanChain({4, 7}).order, "0");
+  EXPECT_THROW(S21Matrix::PlanChain({4}), std::invalid_argument);
+  EXPECT_THROW(S21Matrix::PlanChain({4, 0, 3}), std::invalid_argument);
+}
+
+TEST(MulChainTest, SingleAndPair) {
+  S21Matrix A = ModuloMatrix(3, 2);
+  S21Matrix B = ModuloMatrix(2, 5);
+
+  EXPECT_TRUE(S21Matrix::MulChain({&A}).EqMatrix(A));
+  EXPECT_TRUE(S21Matrix::MulChain({&A, &B}).EqMatrix(A * B));
+}
+
+TEST(MulChainTest, RepeatedOperand) {
+  S21Matrix A = ModuloMatrix(6, 6);
+
+  S21Matrix result = S21Matrix::MulChain({&A, &A, &A, &A, &A});
+
+  EXPECT_TRUE(result.Compare(A * A * A * A * A, 1e-9).equal);
+}
+
+TEST(MulChainTest, Errors) {
+  S21Matrix A = ModuloMatrix(3, 2);
+  S21Matrix B = ModuloMatrix(3, 2);
+
+  EXPECT_THROW(S21Matrix::MulChain({}), std::invalid_argument);
+  EXPECT_THROW(S21Matrix::MulChain({&A, nullptr}), std::invalid_argument);
+  EXPECT_THROW(S21Matrix::MulChain({&A, &B}), std::logic_error);
+}
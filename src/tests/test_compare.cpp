@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "../s21_matrix_oop.h"
+#include "test_helpers.h"
+
+static S21Matrix CountingMatrix(int rows, int cols) {
+  return FillMatrix(rows, cols,
+                    [cols](int i, int j) { return i * cols + j + 1.0; });
+}
+
+TEST(CompareTest, EqualMatrices) {
+  S21Matrix A = CountingMatrix(3, 4);
+  S21Comparison r = A.Compare(A, 0.0);
+
+  EXPECT_TRUE(r.equal);
+  EXPECT_DOUBLE_EQ(r.max_deviation, 0.0);
+  EXPECT_EQ(r.mismatch_row, -1);
+  EXPECT_EQ(r.mismatch_col, -1);
+}
+
+TEST(CompareTest, MaxDeviationAndFirstMismatch) {
+  S21Matrix A = CountingMatrix(5, 70);
+  S21Matrix B(A);
+  B(1, 65) += 0.5;
+  B(3, 2) -= 2.0;
+
+  S21Comparison r = A.Compare(B, 0.1);
+
+  EXPECT_FALSE(r.equal);
+  EXPECT_DOUBLE_EQ(r.max_deviation, 2.0);
+  EXPECT_EQ(r.max_row, 3);
+  EXPECT_EQ(r.max_col, 2);
+  EXPECT_EQ(r.mismatch_row, 1);
+  EXPECT_EQ(r.mismatch_col, 65);
+}
+
+TEST(CompareTest, StopAtFirst) {
+  S21Matrix A = CountingMatrix(4, 4);
+  S21Matrix B(A);
+  B(0, 1) += 1.0;
+  B(3, 3) += 5.0;
+
+  S21Comparison r = A.Compare(B, 1e-9, S21Tolerance::kAbsolute, true);
+
+  EXPECT_FALSE(r.equal);
+  EXPECT_EQ(r.mismatch_row, 0);
+  EXPECT_EQ(r.mismatch_col, 1);
+}
+
+TEST(CompareTest, RelativeTolerance) {
+  S21Matrix A(1, 2);
+  S21Matrix B(1, 2);
+  A(0, 0) = 1e6;
+  B(0, 0) = 1e6 + 1.0;
+  A(0, 1) = 1e-6;
+  B(0, 1) = 1.1e-6;
+
+  EXPECT_FALSE(A.Compare(B, 1e-3, S21Tolerance::kRelative).equal);
+  S21Comparison r = A.Compare(B, 0.1, S21Tolerance::kRelative);
+  EXPECT_TRUE(r.equal);
+  EXPECT_EQ(r.max_col, 1);
+}
+
+TEST(CompareTest, UlpTolerance) {
+  S21Matrix A(1, 2);
+  S21Matrix B(1, 2);
+  A(0, 0) = 1.0;
+  B(0, 0) = std::nextafter(std::nextafter(1.0, 2.0), 2.0);
+  A(0, 1) = 0.0;
+  B(0, 1) = -0.0;
+
+  S21Comparison r = A.Compare(B, 2.0, S21Tolerance::kUlp);
+  EXPECT_TRUE(r.equal);
+  EXPECT_DOUBLE_EQ(r.max_deviation, 2.0);
+  EXPECT_FALSE(A.Compare(B, 1.0, S21Tolerance::kUlp).equal);
+}
+
+TEST(CompareTest, NanIsMismatch) {
+  S21Matrix A(2, 2);
+  S21Matrix B(2, 2);
+  B(1, 0) = std::numeric_limits<double>::quiet_NaN();
+
+  S21Comparison r = A.Compare(B, 1.0);
+
+  EXPECT_FALSE(r.equal);
+  EXPECT_TRUE(std::isinf(r.max_deviation));
+  EXPECT_EQ(r.mismatch_row, 1);
+  EXPECT_FALSE(A.EqMatrix(B));
+}
+
+TEST(CompareTest, InfinityEqualsItself) {
+  const double inf = std::numeric_limits<double>::infinity();
+  S21Matrix A = CountingMatrix(2, 2);
+  A(0, 1) = inf;
+  A(1, 0) = -inf;
+  S21Matrix B(A);
+  B(1, 1) = 4.0;  // собственный блок, а не общий с A
+
+  EXPECT_TRUE(A == B);
+  EXPECT_TRUE(A.Compare(B, 0.0, S21Tolerance::kRelative).equal);
+  EXPECT_TRUE(A.Compare(B, 0.0, S21Tolerance::kUlp).equal);
+  B(0, 1) = -inf;
+  EXPECT_FALSE(A == B);
+}
+
+TEST(CompareTest, MovedFromMatrices) {
+  S21Matrix A(2, 2), B(2, 2);
+  S21Matrix C(std::move(A)), D(std::move(B));
+
+  EXPECT_TRUE(A == B);
+  EXPECT_TRUE(A.EqMatrix(B));
+  EXPECT_FALSE(A == C);
+}
+
+TEST(CompareTest, DifferentDimensions) {
+  S21Matrix A(2, 3);
+  S21Matrix B(3, 2);
+
+  S21Comparison r = A.Compare(B, 1.0);
+
+  EXPECT_FALSE(r.equal);
+  EXPECT_EQ(r.max_row, -1);
+}
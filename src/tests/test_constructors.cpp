@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <thread>
+#include <vector>
+
 #include "../s21_matrix_oop.h"
 
 TEST(ConstructorsTest, Default) {
@@ -80,4 +84,80 @@ TEST(ConstructorsTest, TransferConstructor) {
 
   EXPECT_EQ(M.GetRows(), 0);
   EXPECT_EQ(M.GetCols(), 0);
-}
\ No newline at end of file
+}
+
+TEST(ConstructorsTest, AlignedRows) {
+  S21Matrix M(4, 1024);
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&M(i, 0)) % 64, 0u);
+  }
+  // Шаг строки не кратен 4 КБ
+  std::uintptr_t step = reinterpret_cast<std::uintptr_t>(&M(1, 0)) -
+                        reinterpret_cast<std::uintptr_t>(&M(0, 0));
+  EXPECT_NE(step % 4096, 0u);
+}
+
+TEST(ConstructorsTest, PaddedCopyAndResize) {
+  S21Matrix M(3, 512);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 512; ++j) M(i, j) = i * 1000 + j;
+  }
+
+  S21Matrix C(M);
+  C.SetCols(700);
+  S21Matrix T = M.Transpose();
+
+  EXPECT_TRUE(T.Transpose().EqMatrix(M));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_DOUBLE_EQ(C(i, 511), i * 1000 + 511);
+    EXPECT_DOUBLE_EQ(C(i, 512), 0.0);
+  }
+}
+
+TEST(ConstructorsTest, CopyOnWrite) {
+  S21Matrix M(2, 3);
+  M(0, 0) = 1.5;
+  const S21Matrix& view = M;
+
+  S21Matrix C(M);
+  S21Matrix A(5, 5);
+  A = M;
+  // Копии разделяют блок до первой записи
+  EXPECT_EQ(static_cast<const S21Matrix&>(C).Row(0), view.Row(0));
+  EXPECT_EQ(static_cast<const S21Matrix&>(A).Row(0), view.Row(0));
+
+  C(0, 0) = 2.5;
+  A.MulNumber(2.0);
+  EXPECT_NE(static_cast<const S21Matrix&>(C).Row(0), view.Row(0));
+  EXPECT_DOUBLE_EQ(M(0, 0), 1.5);
+  EXPECT_DOUBLE_EQ(C(0, 0), 2.5);
+  EXPECT_DOUBLE_EQ(A(0, 0), 3.0);
+
+  // Единственный владелец пишет на месте
+  const double* before = view.Row(0);
+  M.SumMatrix(M);
+  EXPECT_EQ(view.Row(0), before);
+  EXPECT_DOUBLE_EQ(M(0, 0), 3.0);
+}
+
+TEST(ConstructorsTest, CopyOnWriteAcrossThreads) {
+  S21Matrix M(8, 8);
+  for (int i = 0; i < 8; ++i) M(i, i) = 1.0;
+
+  std::vector<S21Matrix> copies(4, M);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&copies, t] {
+      for (int k = 0; k < 100; ++k) {
+        S21Matrix local(copies[t]);
+        local(0, 0) += 1.0;
+        copies[t] = local;
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  for (const S21Matrix& copy : copies) EXPECT_DOUBLE_EQ(copy(0, 0), 101.0);
+  EXPECT_DOUBLE_EQ(M(0, 0), 1.0);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+
+static S21Matrix MakeSymmetric(int n) {
+  S21Matrix M(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      double value = std::sin(i * 1.3 + j * 0.7) + (i == j ? i * 0.5 : 0.0);
+      M(i, j) = value;
+      M(j, i) = value;
+    }
+  }
+  return M;
+}
+
+static void ExpectEigenPairs(const S21Matrix& A, const S21EigenResult& r,
+                             double tolerance) {
+  int n = A.GetRows();
+  for (int j = 0; j < r.values.GetSize(); ++j) {
+    S21Vector v(n);
+    for (int i = 0; i < n; ++i) v(i) = r.vectors(i, j);
+    S21Vector av = A.MulVector(v);
+    for (int i = 0; i < n; ++i) {
+      EXPECT_NEAR(av(i), r.values(j) * v(i), tolerance);
+    }
+  }
+}
+
+TEST(EigenTest, Diagonal) {
+  S21Matrix D(3, 3);
+  D(0, 0) = 2;
+  D(1, 1) = -1;
+  D(2, 2) = 5;
+
+  S21EigenResult r = D.EigenSymmetric();
+
+  EXPECT_DOUBLE_EQ(r.values(0), 5);
+  EXPECT_DOUBLE_EQ(r.values(1), 2);
+  EXPECT_DOUBLE_EQ(r.values(2), -1);
+  EXPECT_NEAR(std::fabs(r.vectors(2, 0)), 1.0, 1e-12);
+}
+
+TEST(EigenTest, FullSymmetric) {
+  S21Matrix A = MakeSymmetric(12);
+
+  S21EigenResult r = A.EigenSymmetric();
+
+  ExpectEigenPairs(A, r, 1e-10);
+  S21Matrix vt = r.vectors.Transpose();
+  S21Matrix gram = vt * r.vectors;
+  for (int i = 0; i < 12; ++i) EXPECT_NEAR(gram(i, i), 1.0, 1e-12);
+  for (int j = 1; j < 12; ++j) EXPECT_GE(r.values(j - 1), r.values(j));
+}
+
+TEST(EigenTest, NotSymmetric) {
+  S21Matrix A = MakeSymmetric(3);
+  A(0, 2) += 1.0;
+
+  EXPECT_THROW(A.EigenSymmetric(), std::logic_error);
+  EXPECT_THROW(S21Matrix(2, 3).EigenSymmetric(), std::logic_error);
+}
+
+TEST(EigenTest, RoundoffNearZeroIsSymmetric) {
+  S21Matrix A = MakeSymmetric(3);
+  A(0, 2) = 1e-17;
+  A(2, 0) = 2e-17;
+
+  EXPECT_NO_THROW(A.EigenSymmetric());
+}
+
+TEST(LanczosTest, MatchesDenseSolver) {
+  S21Matrix A = MakeSymmetric(80);
+
+  S21EigenResult full = A.EigenSymmetric();
+  S21EigenResult top = A.TopEigen(4);
+
+  EXPECT_TRUE(top.converged);
+  for (int j = 0; j < 4; ++j) EXPECT_NEAR(top.values(j), full.values(j), 1e-8);
+  ExpectEigenPairs(A, top, 1e-6);
+}
+
+TEST(LanczosTest, OperatorCallback) {
+  // Оператор второй разности: собственные значения 2 - 2cos(pi j/(n+1))
+  const int n = 200;
+  S21LinearOperator laplacian = [](const S21Vector& x, S21Vector& y) {
+    int size = x.GetSize();
+    for (int i = 0; i < size; ++i) {
+      double left = i > 0 ? x(i - 1) : 0.0;
+      double right = i + 1 < size ? x(i + 1) : 0.0;
+      y(i) = 2.0 * x(i) - left - right;
+    }
+  };
+  S21LanczosOptions options;
+  options.max_subspace = 40;
+  options.max_restarts = 500;
+  options.tolerance = 1e-9;
+
+  S21EigenResult r = S21Matrix::TopEigen(n, 3, laplacian, options);
+
+  EXPECT_TRUE(r.converged);
+  for (int j = 0; j < 3; ++j) {
+    double expected = 2.0 - 2.0 * std::cos(M_PI * (n - j) / (n + 1.0));
+    EXPECT_NEAR(r.values(j), expected, 1e-7);
+  }
+}
+
+TEST(LanczosTest, IndefiniteSpectrum) {
+  // Q diag(1e-6, -100/59, ..., -100) Q^T, Q = I - 2 w w^T / |w|^2:
+  // допуск отсчитывается от наибольшего по модулю значения -100,
+  // а не от наибольшего алгебраически 1e-6
+  const int n = 60;
+  std::vector<double> d(n), w(n);
+  double norm = 0.0;
+  for (int i = 0; i < n; ++i) {
+    d[i] = i == 0 ? 1e-6 : -100.0 * i / (n - 1);
+    w[i] = std::sin(i + 1.0);
+    norm += w[i] * w[i];
+  }
+  double dw = 0.0;  // w^T D w / |w|^2
+  for (int l = 0; l < n; ++l) dw += d[l] * w[l] * w[l] / norm;
+  S21Matrix A(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      A(i, j) = (i == j ? d[i] : 0.0) +
+                w[i] * w[j] / norm * (4.0 * dw - 2.0 * (d[i] + d[j]));
+    }
+  }
+
+  S21EigenResult r = A.TopEigen(2);
+
+  EXPECT_TRUE(r.converged);
+  EXPECT_NEAR(r.values(0), 1e-6, 1e-9);
+  EXPECT_NEAR(r.values(1), -100.0 / (n - 1), 1e-9);
+  ExpectEigenPairs(A, r, 1e-8);
+}
+
+TEST(LanczosTest, InvalidArguments) {
+  S21Matrix A = MakeSymmetric(5);
+
+  EXPECT_THROW(A.TopEigen(0), std::invalid_argument);
+  EXPECT_THROW(A.TopEigen(6), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(2, 3).TopEigen(1), std::logic_error);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+#include "test_helpers.h"
+
+static S21Matrix ToeplitzMatrix(int rows, int cols) {
+  return FillMatrix(rows, cols, [](int i, int j) { return 0.01 * (i - j); });
+}
+
+TEST(ElementwiseTest, ApplyAndMap) {
+  S21Matrix A = ToeplitzMatrix(300, 250);
+  auto sigmoid = [](double x) { return 1.0 / (1.0 + std::exp(-x)); };
+
+  S21Matrix S = A.Map(sigmoid);
+  for (int i = 0; i < 300; i += 7) {
+    for (int j = 0; j < 250; j += 3) {
+      EXPECT_DOUBLE_EQ(S(i, j), sigmoid(A(i, j)));
+    }
+  }
+  EXPECT_DOUBLE_EQ(A(0, 1), -0.01);
+
+  // Копия разделяет хранение и отделяется при изменении
+  S21Matrix B(A);
+  B.Apply(sigmoid);
+  EXPECT_TRUE(B.EqMatrix(S));
+  EXPECT_DOUBLE_EQ(A(0, 1), -0.01);
+
+  // Каждый элемент обрабатывается ровно один раз
+  std::atomic<int> calls{0};
+  A.Apply([&calls](double x) {
+    calls.fetch_add(1, std::memory_order_relaxed);
+    return std::clamp(x, -0.5, 0.5);
+  });
+  EXPECT_EQ(calls.load(), 300 * 250);
+  EXPECT_DOUBLE_EQ(A(299, 0), 0.5);
+  EXPECT_DOUBLE_EQ(A(0, 249), -0.5);
+  EXPECT_DOUBLE_EQ(A(10, 3), 0.07);
+}
+
+TEST(ElementwiseTest, ZipWith) {
+  S21Matrix A = ToeplitzMatrix(5, 130);
+  S21Matrix B = A.Map([](double x) { return 2.0 * x + 1.0; });
+
+  auto fma = [](double x, double y) { return x * y + 1.0; };
+  S21Matrix C = S21Matrix::ZipWith(A, B, fma);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 130; ++j) {
+      EXPECT_DOUBLE_EQ(C(i, j), A(i, j) * B(i, j) + 1.0);
+    }
+  }
+
+  A.ZipWith(B, fma);
+  EXPECT_TRUE(A.EqMatrix(C));
+  A.ZipWith(A, [](double x, double y) { return x - y; });
+  EXPECT_EQ(A.MaxAbs(), 0.0);
+
+  S21Matrix D(5, 129);
+  EXPECT_THROW(A.ZipWith(D, fma), std::logic_error);
+  EXPECT_THROW(S21Matrix::ZipWith(A, D, fma), std::logic_error);
+}
+
+TEST(ElementwiseTest, InvalidatesCache) {
+  S21Matrix A(2, 2);
+  A(0, 0) = 1.0;
+  A(1, 1) = 2.0;
+  EXPECT_DOUBLE_EQ(A.Determinant(), 2.0);
+  A.Apply([](double x) { return 3.0 * x; });
+  EXPECT_DOUBLE_EQ(A.Determinant(), 18.0);
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../s21_matrix_oop.h"
+
+// A = L U: L с единицами на диагонали, U с diagonal на диагонали,
+// небольшие случайные элементы вне диагонали; det A = diagonal^n
+static S21Matrix MakeProduct(int n, double diagonal, unsigned seed) {
+  std::mt19937 engine(seed);
+  std::uniform_int_distribution<int> value(-2, 2);
+  S21Matrix l(n, n), u(n, n);
+  for (int i = 0; i < n; ++i) {
+    l(i, i) = 1.0;
+    u(i, i) = diagonal;
+    for (int j = 0; j < i; ++j) {
+      l(i, j) = value(engine);
+      u(j, i) = value(engine);
+    }
+  }
+  return l * u;
+}
+
+TEST(ExactTest, SmallDeterminant) {
+  S21Matrix m(3, 3);
+  double values[] = {2, 5, 7, 6, 3, 4, 5, -2, -3};
+  for (int k = 0; k < 9; ++k) m(k / 3, k % 3) = values[k];
+  EXPECT_EQ(m.ExactDeterminant(), "-1");
+  EXPECT_EQ(m.ExactRank(), 3);
+
+  S21Matrix one(1, 1);
+  one(0, 0) = -42;
+  EXPECT_EQ(one.ExactDeterminant(), "-42");
+  EXPECT_EQ(S21Matrix(4, 4).ExactDeterminant(), "0");
+  EXPECT_EQ(S21Matrix(4, 4).ExactRank(), 0);
+}
+
+TEST(ExactTest, WideDeterminant) {
+  // 10^27 переполняет int64 и считается в __int128
+  S21Matrix m(3, 3);
+  for (int i = 0; i < 3; ++i) m(i, i) = 1e9;
+  m(0, 2) = 7;
+  EXPECT_EQ(m.ExactDeterminant(), "1000000000000000000000000000");
+  m(0, 0) = -1e9;
+  EXPECT_EQ(m.ExactDeterminant(), "-1000000000000000000000000000");
+}
+
+TEST(ExactTest, MultimodularDeterminant) {
+  S21Matrix m = MakeProduct(60, 2.0, 1);
+  EXPECT_EQ(m.ExactDeterminant(), "1152921504606846976");
+  // 3^100 не помещается в __int128
+  const std::string power = "515377520732011331036461129765621272702107522001";
+  S21Matrix big = MakeProduct(100, 3.0, 2);
+  EXPECT_EQ(big.ExactDeterminant(), power);
+  for (int j = 0; j < 100; ++j) std::swap(big(3, j), big(70, j));
+  EXPECT_EQ(big.ExactDeterminant(), "-" + power);
+  EXPECT_EQ(big.ExactRank(), 100);
+}
+
+TEST(ExactTest, Rank) {
+  // 40 x 30 произведение множителей ранга 12
+  std::mt19937 engine(7);
+  std::uniform_int_distribution<int> value(-9, 9);
+  S21Matrix left(40, 12), right(12, 30);
+  for (int i = 0; i < 40; ++i) {
+    for (int j = 0; j < 12; ++j) left(i, j) = value(engine);
+  }
+  for (int i = 0; i < 12; ++i) {
+    for (int j = 0; j < 30; ++j) right(i, j) = value(engine);
+  }
+  S21Matrix m = left * right;
+  EXPECT_EQ(m.ExactRank(), 12);
+  EXPECT_EQ(m.Transpose().ExactRank(), 12);
+
+  S21Matrix square = MakeProduct(50, 3.0, 3);
+  for (int j = 0; j < 50; ++j) square(49, j) = square(0, j) - square(1, j);
+  EXPECT_EQ(square.ExactRank(), 49);
+  EXPECT_EQ(square.ExactDeterminant(), "0");
+}
+
+TEST(ExactTest, RejectsNonIntegers) {
+  S21Matrix m(2, 2);
+  m(0, 1) = 0.5;
+  EXPECT_THROW(m.ExactDeterminant(), std::invalid_argument);
+  EXPECT_THROW(m.ExactRank(), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(2, 3).ExactDeterminant(), std::logic_error);
+}
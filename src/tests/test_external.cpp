@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+
+// Буфер 3 x 4 с шагом строки 6: последние два элемента строки — хвост
+static std::vector<double> MakeBuffer() {
+  std::vector<double> buffer(18, -1.0);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) buffer[i * 6 + j] = i * 4 + j + 1;
+  }
+  return buffer;
+}
+
+TEST(ExternalTest, BorrowedBufferIsNotCopied) {
+  std::vector<double> buffer = MakeBuffer();
+  S21Matrix m(buffer.data(), 3, 4, 6);
+  EXPECT_TRUE(m.IsExternal());
+  EXPECT_EQ(m.GetStride(), 6);
+  EXPECT_EQ(m.Row(1), buffer.data() + 6);
+  EXPECT_EQ(m(2, 3), 12.0);
+
+  m(1, 2) = 100.0;
+  m.MulNumber(2.0);
+  EXPECT_EQ(buffer[8], 200.0);
+  EXPECT_EQ(buffer[0], 2.0);
+  EXPECT_EQ(buffer[4], -1.0);  // хвост строки не трогается
+  EXPECT_TRUE(m.IsExternal());
+}
+
+TEST(ExternalTest, OperationsOnForeignMemory) {
+  std::vector<double> a = {2.0, 1.0, 0.0, 1.0, 3.0, 1.0, 0.0, 1.0, 4.0};
+  std::vector<double> b(9, 0.0);
+  S21Matrix ma(a.data(), 3, 3, 3), mb(b.data(), 3, 3, 3);
+  S21Matrix owned(3, 3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) owned(i, j) = a[i * 3 + j];
+  }
+  EXPECT_NEAR(ma.Determinant(), owned.Determinant(), 1e-12);
+  EXPECT_TRUE(ma.InverseMatrix().EqMatrix(owned.InverseMatrix()));
+  EXPECT_TRUE(ma == owned);
+
+  mb.Gemm(1.0, ma, owned, 0.0);
+  S21Matrix product = owned * owned;
+  EXPECT_TRUE(mb.EqMatrix(product));
+  EXPECT_EQ(b[4], product(1, 1));
+  mb.SumMatrix(ma);
+  EXPECT_EQ(b[0], product(0, 0) + 2.0);
+  EXPECT_TRUE(mb.IsExternal());
+}
+
+TEST(ExternalTest, DeleterRunsOnceAfterLastCopy) {
+  int calls = 0;
+  double* released = nullptr;
+  double* data = new double[4]{1.0, 2.0, 3.0, 4.0};
+  {
+    S21Matrix m(data, 2, 2, 2, 1, [&](double* p) {
+      ++calls;
+      released = p;
+      delete[] p;
+    });
+    S21Matrix copy(m);
+    {
+      S21Matrix moved(std::move(m));
+      EXPECT_EQ(moved(1, 0), 3.0);
+    }
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(copy.Determinant(), -2.0);
+  }
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(released, data);
+}
+
+TEST(ExternalTest, WritingCopyDetaches) {
+  std::vector<double> buffer = MakeBuffer();
+  S21Matrix m(buffer.data(), 3, 4, 6);
+  S21Matrix copy(m);
+  copy(0, 0) = 50.0;
+  EXPECT_FALSE(copy.IsExternal());
+  EXPECT_EQ(buffer[0], 1.0);
+  EXPECT_EQ(copy(2, 3), 12.0);
+
+  // Оригинал снова единственный владелец и пишет в буфер
+  m(0, 0) = 7.0;
+  EXPECT_TRUE(m.IsExternal());
+  EXPECT_EQ(buffer[0], 7.0);
+
+  S21Matrix shared(m);
+  m.SetCols(5);
+  EXPECT_FALSE(m.IsExternal());
+  EXPECT_EQ(m(2, 3), 12.0);
+  EXPECT_TRUE(shared.IsExternal());
+}
+
+TEST(ExternalTest, StridedColumnsAreCopied) {
+  // Транспонированный вид буфера 3 x 4: шаг строки 1, шаг столбца 6
+  std::vector<double> buffer = MakeBuffer();
+  int calls = 0;
+  S21Matrix t(buffer.data(), 4, 3, 1, 6, [&](double*) { ++calls; });
+  EXPECT_EQ(calls, 1);
+  EXPECT_FALSE(t.IsExternal());
+  S21Matrix expected = S21Matrix(buffer.data(), 3, 4, 6).Transpose();
+  EXPECT_TRUE(t.EqMatrix(expected));
+  t(0, 0) = 9.0;
+  EXPECT_EQ(buffer[0], 1.0);
+}
+
+TEST(ExternalTest, InvalidArguments) {
+  std::vector<double> buffer(4);
+  EXPECT_THROW(S21Matrix(nullptr, 2, 2, 2), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(buffer.data(), 0, 2, 2), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(buffer.data(), 2, 2, 0), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(buffer.data(), 2, 2, 2, 0), std::invalid_argument);
+}
+
+TEST(ExternalTest, DeleterRunsWhenConstructionFails) {
+  int calls = 0;
+  S21Matrix::Deleter count = [&](double*) { ++calls; };
+  std::vector<double> buffer(4);
+  EXPECT_THROW(S21Matrix(buffer.data(), 0, 2, 2, 1, count),
+               std::invalid_argument);
+  EXPECT_THROW(S21Matrix(buffer.data(), 2, 2, 0, 1, count),
+               std::invalid_argument);
+  EXPECT_THROW(S21Matrix(nullptr, 2, 2, 2, 1, count), std::invalid_argument);
+  EXPECT_EQ(calls, 3);
+
+  // Без deleter буфер заимствован, и неудача его не касается
+  EXPECT_THROW(S21Matrix(buffer.data(), 2, 2, 2, 0), std::invalid_argument);
+  EXPECT_EQ(calls, 3);
+}
+
+#if defined(S21_MATRIX_MDSPAN)
+TEST(ExternalTest, MdSpanViews) {
+  std::vector<double> buffer = MakeBuffer();
+  s21_md::mdspan<double, s21_md::dextents<int, 2>, s21_md::layout_stride> in(
+      buffer.data(),
+      {s21_md::dextents<int, 2>(3, 4), std::array<int, 2>{6, 1}});
+  S21Matrix m(in);
+  EXPECT_TRUE(m.IsExternal());
+
+  S21Matrix::MdSpan view = m.View();
+  EXPECT_EQ(view.data_handle(), buffer.data());
+  EXPECT_EQ(view.stride(0), 6);
+#if defined(__cpp_multidimensional_subscript)
+  view[2, 1] = 30.0;
+#else
+  view(2, 1) = 30.0;  // эталонная реализация под C++20
+#endif
+  EXPECT_EQ(buffer[13], 30.0);
+
+  const S21Matrix& cm = m;
+  S21Matrix::ConstMdSpan cview = cm.View();
+  EXPECT_EQ(cview.extent(0), 3);
+  EXPECT_EQ(cview.extent(1), 4);
+  EXPECT_EQ(cm(2, 1), 30.0);
+}
+#endif
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "../s21_matrix_oop.h"
+
+static S21Matrix MakeMatrix3x3() {
+  S21Matrix M(3, 3);
+  M(0, 0) = 2;
+  M(0, 1) = 5;
+  M(0, 2) = 7;
+  M(1, 0) = 6;
+  M(1, 1) = 3;
+  M(1, 2) = 4;
+  M(2, 0) = 5;
+  M(2, 1) = -2;
+  M(2, 2) = -3;
+  return M;
+}
+
+TEST(FactorizationTest, DeterminantLargeMatrix) {
+  S21Matrix M(6, 6);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) M(i, j) = (i == j) ? 4.0 : 1.0;
+  }
+  // Собственные значения: 3 (кратность 5) и 9
+  EXPECT_NEAR(M.Determinant(), 9.0 * 243.0, 1e-7);
+}
+
+TEST(FactorizationTest, CachedQueriesAreConsistent) {
+  S21Matrix M = MakeMatrix3x3();
+  double det = M.Determinant();
+  S21Matrix inv1 = M.InverseMatrix();
+  S21Matrix inv2 = M.InverseMatrix();
+
+  EXPECT_NEAR(det, -1.0, 1e-7);
+  EXPECT_TRUE(inv1.EqMatrix(inv2));
+  EXPECT_NEAR(M.Determinant(), det, 1e-12);
+}
+
+TEST(FactorizationTest, InvalidatedByMutation) {
+  S21Matrix M = MakeMatrix3x3();
+  EXPECT_NEAR(M.Determinant(), -1.0, 1e-7);
+
+  M(0, 0) = 3;
+  EXPECT_NEAR(M.Determinant(), -2.0, 1e-7);
+
+  M.MulNumber(2.0);
+  EXPECT_NEAR(M.Determinant(), -16.0, 1e-7);
+
+  S21Matrix inv = M.InverseMatrix();
+  M.SumMatrix(M);
+  S21Matrix inv_half = M.InverseMatrix();
+  EXPECT_NEAR(inv_half(1, 1), inv(1, 1) / 2.0, 1e-7);
+}
+
+TEST(FactorizationTest, Solve) {
+  S21Matrix M = MakeMatrix3x3();
+  S21Matrix b(3, 1);
+  b(0, 0) = 1;
+  b(1, 0) = 2;
+  b(2, 0) = 3;
+
+  S21Matrix x = M.Solve(b);
+  S21Matrix check = M * x;
+
+  EXPECT_TRUE(check.EqMatrix(b));
+}
+
+TEST(FactorizationTest, SolveSingular) {
+  S21Matrix M(3, 3);
+  M(0, 0) = 1;
+  M(1, 1) = 1;
+  S21Matrix b(3, 1);
+
+  EXPECT_THROW(M.Solve(b), std::logic_error);
+}
+
+TEST(FactorizationTest, BadlyScaledIsNotSingular) {
+  S21Matrix M(3, 3);
+  M(0, 0) = 1e-12;
+  M(1, 1) = 1e4;
+  M(2, 2) = 1;
+
+  EXPECT_NEAR(M.Determinant(), 1e-8, 1e-20);
+  S21Matrix inv = M.InverseMatrix();
+  EXPECT_NEAR(inv(0, 0), 1e12, 1e-4);
+  EXPECT_NEAR(inv(1, 1), 1e-4, 1e-16);
+  // Численный ранг по-прежнему учитывает масштаб
+  EXPECT_EQ(M.Rank(), 2);
+}
+
+TEST(FactorizationTest, SolveWrongDimensions) {
+  S21Matrix M = MakeMatrix3x3();
+  S21Matrix b(2, 1);
+
+  EXPECT_THROW(M.Solve(b), std::logic_error);
+}
+
+TEST(FactorizationTest, Rank) {
+  S21Matrix M(3, 4);
+  for (int j = 0; j < 4; ++j) {
+    M(0, j) = j + 1;
+    M(1, j) = 2 * (j + 1);
+    M(2, j) = j * j;
+  }
+
+  EXPECT_EQ(M.Rank(), 2);
+  EXPECT_EQ(MakeMatrix3x3().Rank(), 3);
+  EXPECT_EQ(S21Matrix(2, 2).Rank(), 0);
+}
+
+TEST(FactorizationTest, CacheDisabled) {
+  S21Matrix M = MakeMatrix3x3();
+  M.SetCacheEnabled(false);
+
+  EXPECT_FALSE(M.IsCacheEnabled());
+  EXPECT_NEAR(M.Determinant(), -1.0, 1e-7);
+  S21Matrix inv = M.InverseMatrix();
+  S21Matrix identity = M * inv;
+  EXPECT_NEAR(identity(2, 2), 1.0, 1e-7);
+  EXPECT_EQ(M.Rank(), 3);
+}
@@ -0,0 +1,53 @@
+#ifndef S21_TEST_HELPERS_H
+#define S21_TEST_HELPERS_H
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "../s21_matrix_oop.h"
+
+// Общие фабрики тестовых матриц и сравнение с допуском
+
+// Матрица rows x cols с элементами f(i, j)
+template <class F>
+S21Matrix FillMatrix(int rows, int cols, F f) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = f(i, j);
+  }
+  return m;
+}
+
+// Элементы (i + 1) / 2 - j + shift: без нулевых строк и столбцов
+inline S21Matrix LinearMatrix(int rows, int cols, double shift = 0.0) {
+  return FillMatrix(rows, cols, [shift](int i, int j) {
+    return (i + 1) * 0.5 - j + shift;
+  });
+}
+
+// Элементы, равномерно распределённые на [-1, 1]
+inline S21Matrix RandomMatrix(int rows, int cols, unsigned seed = 42) {
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  return FillMatrix(rows, cols, [&](int, int) { return value(engine); });
+}
+
+inline S21Matrix Identity(int n) {
+  S21Matrix e(n, n);
+  for (int i = 0; i < n; ++i) e(i, i) = 1.0;
+  return e;
+}
+
+inline void ExpectNearMatrix(const S21Matrix& a, const S21Matrix& b,
+                             double eps) {
+  ASSERT_EQ(a.GetRows(), b.GetRows());
+  ASSERT_EQ(a.GetCols(), b.GetCols());
+  for (int i = 0; i < a.GetRows(); ++i) {
+    for (int j = 0; j < a.GetCols(); ++j) {
+      EXPECT_NEAR(a(i, j), b(i, j), eps);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "../s21_io.h"
+#include "test_helpers.h"
+
+static S21Matrix IndexedMatrix(int rows, int cols) {
+  return FillMatrix(rows, cols,
+                    [](int i, int j) { return i * 100 + j + 0.25; });
+}
+
+static std::string TempPath(const std::string& name) {
+  return ::testing::TempDir() + "s21_io_" + name;
+}
+
+TEST(BufferTest, RowAndColumnMajor) {
+  double data[6] = {1, 2, 3, 4, 5, 6};
+  S21Matrix rows = S21FromBuffer(data, 2, 3);
+  S21Matrix cols = S21FromBuffer(data, 2, 3, S21Layout::kColumnMajor);
+
+  EXPECT_DOUBLE_EQ(rows(1, 0), 4);
+  EXPECT_DOUBLE_EQ(cols(1, 0), 2);
+  EXPECT_DOUBLE_EQ(cols(0, 2), 5);
+
+  float out[6];
+  S21ToBuffer(cols, out, S21Layout::kColumnMajor);
+  for (int k = 0; k < 6; ++k) EXPECT_FLOAT_EQ(out[k], data[k]);
+  EXPECT_THROW(S21FromBuffer(static_cast<double*>(nullptr), 2, 2),
+               std::invalid_argument);
+}
+
+TEST(BufferTest, PaddedRows) {
+  // Строки шире 64 элементов хранятся с отступом
+  S21Matrix M = IndexedMatrix(5, 70);
+  std::vector<double> buffer(5 * 70);
+  S21ToBuffer(M, buffer.data());
+
+  EXPECT_DOUBLE_EQ(buffer[70 * 3 + 69], M(3, 69));
+  EXPECT_TRUE(S21FromBuffer(buffer.data(), 5, 70).EqMatrix(M));
+}
+
+TEST(NpyTest, RoundTripAllFormats) {
+  for (S21Matrix M : {IndexedMatrix(3, 4), IndexedMatrix(7, 70),
+                      IndexedMatrix(1, 5), IndexedMatrix(6, 1)}) {
+    for (S21DType type : {S21DType::kFloat64, S21DType::kFloat32}) {
+      for (S21Layout layout : {S21Layout::kRowMajor, S21Layout::kColumnMajor}) {
+        std::stringstream stream;
+        S21WriteNpy(stream, M, type, layout);
+        EXPECT_EQ(stream.str().find("\x93NUMPY"), 0u);
+        EXPECT_EQ(stream.str().find('\n') % 64, 63u);
+
+        S21Matrix loaded = S21ReadNpy(stream);
+        EXPECT_EQ(loaded.GetRows(), M.GetRows());
+        EXPECT_TRUE(loaded.EqMatrix(M));
+      }
+    }
+  }
+}
+
+TEST(NpyTest, BigEndianAndOneDimensional) {
+  std::string header =
+      "{'descr': '>f4', 'fortran_order': False, 'shape': (2,), }";
+  header.append(128 - 10 - header.size() - 1, ' ');
+  header += '\n';
+  std::string file("\x93NUMPY\x01\x00", 8);
+  file += static_cast<char>(header.size());
+  file += '\0';
+  file += header;
+  file += std::string("\x3f\x80\x00\x00\xc0\x00\x00\x00", 8);  // 1, -2
+
+  std::stringstream stream(file);
+  S21Matrix M = S21ReadNpy(stream);
+
+  EXPECT_EQ(M.GetRows(), 2);
+  EXPECT_EQ(M.GetCols(), 1);
+  EXPECT_DOUBLE_EQ(M(0, 0), 1.0);
+  EXPECT_DOUBLE_EQ(M(1, 0), -2.0);
+}
+
+TEST(NpyTest, RejectsUnsupported) {
+  std::stringstream not_npy("hello world");
+  EXPECT_THROW(S21ReadNpy(not_npy), std::runtime_error);
+
+  std::string header =
+      "{'descr': '<i8', 'fortran_order': False, 'shape': (2, 2), }\n";
+  std::string file("\x93NUMPY\x01\x00", 8);
+  file += static_cast<char>(header.size());
+  file += '\0';
+  std::stringstream int_npy(file + header);
+  EXPECT_THROW(S21ReadNpy(int_npy), std::invalid_argument);
+
+  std::stringstream truncated;
+  S21WriteNpy(truncated, IndexedMatrix(3, 3));
+  std::string data = truncated.str();
+  std::stringstream cut(data.substr(0, data.size() - 1));
+  EXPECT_THROW(S21ReadNpy(cut), std::runtime_error);
+}
+
+TEST(NpyTest, SaveAndLoadFile) {
+  std::string path = TempPath("matrix.npy");
+  S21Matrix M = IndexedMatrix(9, 65);
+  S21SaveNpy(path, M);
+
+  EXPECT_TRUE(S21LoadNpy(path).EqMatrix(M));
+  std::remove(path.c_str());
+  EXPECT_THROW(S21LoadNpy(path), std::runtime_error);
+}
+
+TEST(NpzTest, StreamedArchive) {
+  std::string path = TempPath("bundle.npz");
+  {
+    S21NpzWriter writer(path);
+    writer.Add("a", IndexedMatrix(3, 3));
+    writer.Add("weights", IndexedMatrix(4, 70), S21DType::kFloat32);
+    writer.Close();
+    EXPECT_THROW(writer.Add("late", IndexedMatrix(1, 1)), std::logic_error);
+  }
+
+  S21NpzReader reader(path);
+  ASSERT_EQ(reader.Names().size(), 2u);
+  EXPECT_EQ(reader.Names()[1], "weights");
+  EXPECT_TRUE(reader.Contains("a"));
+  EXPECT_TRUE(reader.Load("weights").EqMatrix(IndexedMatrix(4, 70)));
+  EXPECT_TRUE(reader.Load("a").EqMatrix(IndexedMatrix(3, 3)));
+  EXPECT_THROW(reader.Load("missing"), std::out_of_range);
+  std::remove(path.c_str());
+}
+
+TEST(NpzTest, DetectsCorruption) {
+  std::string path = TempPath("corrupt.npz");
+  {
+    S21NpzWriter writer(path);
+    writer.Add("a", IndexedMatrix(2, 2));
+  }
+  // Портится последний байт данных массива, каталог остаётся целым
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(30 + 5 + 128 + 31);
+  file.put('\x7f');
+  file.close();
+
+  S21NpzReader reader(path);
+  EXPECT_THROW(reader.Load("a"), std::runtime_error);
+  std::remove(path.c_str());
+  EXPECT_THROW(S21NpzReader("/nonexistent/dir/file.npz"),
+               std::runtime_error);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include "../s21_matrix_oop.h"
+
+static S21Matrix MakeWellConditioned(int n) {
+  S21Matrix M(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) M(i, j) = 1.0 / (i + j + 1.0);
+    M(i, i) += n;
+  }
+  return M;
+}
+
+TEST(MixedPrecisionTest, SolveConverges) {
+  S21Matrix A = MakeWellConditioned(40);
+  S21Matrix b(40, 2);
+  for (int i = 0; i < 40; ++i) {
+    b(i, 0) = i + 1.0;
+    b(i, 1) = 1.0 / (i + 1.0);
+  }
+
+  S21RefinementResult r = A.SolveRefined(b);
+
+  EXPECT_TRUE(r.converged);
+  EXPECT_FALSE(r.fallback);
+  EXPECT_GE(r.iterations, 1);
+  EXPECT_LT(r.residual, 1e-14);
+  EXPECT_TRUE(r.solution.Compare(A.Solve(b), 1e-12).equal);
+}
+
+TEST(MixedPrecisionTest, SeveralRightHandSides) {
+  S21Matrix A = MakeWellConditioned(12);
+  S21Matrix b(12, 12);
+  for (int i = 0; i < 12; ++i) b(i, i) = 1.0;
+
+  S21RefinementResult r = A.SolveRefined(b);
+  S21Matrix identity = A * r.solution;
+
+  EXPECT_TRUE(r.converged);
+  for (int i = 0; i < 12; ++i) EXPECT_NEAR(identity(i, i), 1.0, 1e-13);
+}
+
+TEST(MixedPrecisionTest, FallbackForIllConditioned) {
+  // Матрица Гильберта 10x10: обусловленность ~1e13, float не справляется
+  S21Matrix H(10, 10);
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) H(i, j) = 1.0 / (i + j + 1.0);
+  }
+  S21Matrix b(10, 1);
+  b(0, 0) = 1.0;
+
+  S21RefinementResult r = H.SolveRefined(b);
+
+  EXPECT_TRUE(r.fallback);
+  EXPECT_FALSE(r.converged);
+  EXPECT_LT(r.residual, 1e-12);
+}
+
+TEST(MixedPrecisionTest, Errors) {
+  S21Matrix A(2, 3);
+  S21Matrix b(2, 1);
+  S21Matrix singular(2, 2);
+
+  EXPECT_THROW(A.SolveRefined(b), std::logic_error);
+  EXPECT_THROW(MakeWellConditioned(3).SolveRefined(b), std::logic_error);
+  EXPECT_THROW(singular.SolveRefined(b), std::logic_error);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "../s21_executor.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_numa.h"
+#include "../s21_parallel.h"
+#include "../s21_telemetry.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+TEST(NumaTest, Topology) {
+  const std::vector<S21NumaNode>& nodes = S21Numa::Nodes();
+  ASSERT_FALSE(nodes.empty());
+  size_t cpus = 0;
+  for (const S21NumaNode& node : nodes) cpus += node.cpus.size();
+  EXPECT_GT(cpus, 0u);
+  EXPECT_NE(S21Numa::Report().find("# numa nodes: "), std::string::npos);
+}
+
+TEST(NumaTest, PoliciesKeepResults) {
+  // 600 x 600 double — больше порога kMinBytes
+  S21Matrix reference(600, 600);
+  for (int i = 0; i < 600; ++i) {
+    for (int j = 0; j < 600; ++j) reference(i, j) = i * 0.5 - j;
+  }
+  for (S21NumaPolicy policy :
+       {S21NumaPolicy::kFirstTouch, S21NumaPolicy::kInterleave,
+        S21NumaPolicy::kLocal, S21NumaPolicy::kDefault}) {
+    S21Numa::SetPolicy(policy);
+    EXPECT_EQ(S21Numa::PolicyFor(S21Numa::kMinBytes), policy);
+    EXPECT_EQ(S21Numa::PolicyFor(1024), S21NumaPolicy::kDefault);
+
+    S21Matrix m(600, 600);
+    EXPECT_EQ(m.MaxAbs(), 0.0);
+    m.SumMatrix(reference);
+    EXPECT_TRUE(m.EqMatrix(reference));
+
+    std::vector<long> pages = S21Numa::Placement(m);
+    EXPECT_EQ(pages.size(),
+              static_cast<size_t>(S21Numa::Nodes().back().id + 1));
+#if defined(__linux__)
+    EXPECT_GT(std::accumulate(pages.begin(), pages.end(), 0L), 0L);
+#endif
+  }
+}
+
+TEST(NumaTest, PinnedWorkersKeepBlocks) {
+  S21Numa::SetPinning(true);
+  EXPECT_TRUE(S21Numa::IsPinned());
+  EXPECT_GE(S21Numa::WorkerCpu(0), 0);
+
+  // Участник i — рабочий поток i - 1, вызывающий поток берёт блок 0.
+  // Чужой блок перехватывается, только если его владелец не успел
+  // начать, поэтому ожидаемая раскладка проверяется по лучшей попытке
+  auto ideal = [] {
+    std::vector<int> workers(S21ThreadCount(), -2);
+    S21ParallelFor(0, S21ThreadCount(), 1, [&](int from, int to) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      int worker = S21Executor::WorkerIndex();
+#if defined(__linux__)
+      if (worker >= 0) {
+        EXPECT_EQ(sched_getcpu(), S21Numa::WorkerCpu(worker));
+      }
+#endif
+      for (int b = from; b < to; ++b) workers[b] = worker;
+    });
+    for (int b = 0; b < static_cast<int>(workers.size()); ++b) {
+      if (workers[b] != b - 1) return false;
+    }
+    return true;
+  };
+  bool matched = false;
+  for (int attempt = 0; attempt < 10 && !matched; ++attempt) matched = ideal();
+  EXPECT_TRUE(matched);
+
+  S21Numa::SetPinning(false);
+  EXPECT_EQ(S21Numa::WorkerCpu(0), -1);
+}
+
+TEST(NumaTest, TelemetryCountsAllocations) {
+  S21Telemetry::SetEnabled(true);
+  S21Telemetry::Reset();
+  S21Numa::SetPolicy(S21NumaPolicy::kFirstTouch);
+  S21Matrix m(600, 600);
+  S21Numa::SetPolicy(S21NumaPolicy::kDefault);
+  S21Telemetry::SetEnabled(false);
+
+  if (S21Telemetry::kCompiled) {
+    const char* metric =
+        "s21_matrix_numa_allocations_total{policy=\"first-touch\"} 1";
+    EXPECT_NE(S21Telemetry::Dump().find(metric), std::string::npos);
+    EXPECT_NE(S21Numa::Report().find("# first-touch allocations: 1"),
+              std::string::npos);
+  } else {
+    EXPECT_TRUE(S21Telemetry::Dump().empty());
+  }
+  S21Telemetry::Reset();
+}
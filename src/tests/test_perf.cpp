@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <iomanip>
+#include <sstream>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_parallel.h"
+#include "../s21_telemetry.h"
+
+TEST(PerfTest, DisabledRecordsNothing) {
+  S21Perf::SetEnabled(false);
+  S21Perf::Reset();
+
+  S21Matrix A(8, 8);
+  A.MulMatrix(A);
+
+  EXPECT_TRUE(S21Perf::Snapshot().empty());
+}
+
+TEST(PerfTest, ProfilesKernelsBySize) {
+  S21Perf::SetEnabled(true);
+  S21Perf::Reset();
+
+  S21Matrix A(16, 16), B(16, 16), C(16, 16);
+  for (int k = 0; k < 3; ++k) C.Gemm(1.0, A, B, 0.0);
+  S21Perf::SetEnabled(false);
+
+  std::vector<S21PerfStats> stats = S21Perf::Snapshot();
+  if (!S21Perf::kCompiled || !S21Telemetry::kCompiled) {
+    EXPECT_FALSE(S21Perf::IsEnabled());
+    EXPECT_TRUE(stats.empty());
+    return;
+  }
+  bool found = false;
+  for (const S21PerfStats& s : stats) {
+    if (std::string(s.name) != "Gemm") continue;
+    found = true;
+    EXPECT_EQ(s.size_bucket, 8);
+    EXPECT_EQ(s.calls, 3u);
+    EXPECT_EQ(s.flops, 3u * 2 * 16 * 16 * 16);
+    if (S21Perf::IsAvailable(S21PerfEvent::kInstructions)) {
+      EXPECT_EQ(s.counted_calls, 3u);
+      EXPECT_GT(s.counters[static_cast<int>(S21PerfEvent::kInstructions)],
+                0u);
+    }
+  }
+  EXPECT_TRUE(found);
+  EXPECT_NE(S21Perf::Report().find("Gemm"), std::string::npos);
+}
+
+TEST(PerfTest, ReportDerivedMetrics) {
+  S21Perf::Reset();
+  S21PerfSample start, end;
+  start.valid = end.valid = true;
+  end.time_enabled = end.time_running = 1000;
+  end.values[static_cast<int>(S21PerfEvent::kCycles)] = 2000;
+  end.values[static_cast<int>(S21PerfEvent::kInstructions)] = 5000;
+
+  // 500 из 2000 тактов — рабочих потоков, частота вызывающего потока
+  // 1.5 ГГц. 4000 флопов за 1000 нс — 4 GFLOP/s; пик 24 GFLOP/s на поток
+  end.helper_cycles = 500;
+  S21Perf::Record(S21Op::kGemm, 1000, 100, 4000, 8000, start, end);
+  std::vector<S21PerfStats> stats = S21Perf::Snapshot();
+  ASSERT_EQ(stats.size(), 1u);
+  EXPECT_EQ(stats[0].size_bucket, 6);
+  EXPECT_EQ(stats[0].counted_calls, 1u);
+  EXPECT_EQ(stats[0].own_cycles, 1500u);
+
+  int threads = S21ThreadCount();
+  std::ostringstream peak, percent;
+  peak << std::fixed << std::setprecision(1) << "peak GFLOP/s: "
+       << 24.0 * threads << " (estimated, " << threads << " threads)";
+  percent << std::fixed << std::setprecision(1) << std::setw(7)
+          << 100.0 * 4.0 / (24.0 * threads);
+  std::string report = S21Perf::Report();
+  EXPECT_NE(report.find(peak.str()), std::string::npos);
+  EXPECT_NE(report.find("   4.00"), std::string::npos);  // GFLOP/s
+  EXPECT_NE(report.find(percent.str()), std::string::npos);  // % пика
+  EXPECT_NE(report.find("  2.50"), std::string::npos);   // IPC
+  EXPECT_NE(report.find("    2.00"), std::string::npos);  // байт на флоп
+  EXPECT_NE(S21Perf::Report(8.0).find("(given)"), std::string::npos);
+  S21Perf::Reset();
+}
+
+TEST(PerfTest, AccumulatesHelperWork) {
+  S21PerfSample start, end, total;
+  start.valid = end.valid = true;
+  start.time_enabled = start.time_running = 100;
+  end.time_enabled = 300;
+  end.time_running = 200;  // группа считала половину времени
+  start.values[static_cast<int>(S21PerfEvent::kCycles)] = 10;
+  end.values[static_cast<int>(S21PerfEvent::kCycles)] = 60;
+
+  S21Perf::Accumulate(start, end, total);
+  S21Perf::Accumulate(start, end, total);
+  S21Perf::Accumulate(start, S21PerfSample{}, total);  // без счётчиков
+
+  EXPECT_TRUE(total.valid);
+  EXPECT_EQ(total.values[static_cast<int>(S21PerfEvent::kCycles)], 200u);
+  EXPECT_EQ(total.values[static_cast<int>(S21PerfEvent::kInstructions)], 0u);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "../s21_matrix_oop.h"
+
+static S21Matrix Fibonacci() {
+  S21Matrix F(2, 2);
+  F(0, 0) = 1;
+  F(0, 1) = 1;
+  F(1, 0) = 1;
+  return F;
+}
+
+TEST(PowTest, ZeroAndOne) {
+  S21Matrix F = Fibonacci();
+
+  S21Matrix identity = F.Pow(0);
+  EXPECT_DOUBLE_EQ(identity(0, 0), 1.0);
+  EXPECT_DOUBLE_EQ(identity(0, 1), 0.0);
+  EXPECT_TRUE(F.Pow(1).EqMatrix(F));
+}
+
+TEST(PowTest, Fibonacci) {
+  S21Matrix F = Fibonacci();
+
+  S21Matrix P = F.Pow(40);
+
+  EXPECT_DOUBLE_EQ(P(0, 1), 102334155.0);
+  EXPECT_DOUBLE_EQ(P(0, 0), 165580141.0);
+}
+
+TEST(PowTest, MatchesRepeatedMultiplication) {
+  S21Matrix A(3, 3);
+  A(0, 0) = 0.5;
+  A(0, 2) = 0.25;
+  A(1, 1) = -0.75;
+  A(2, 0) = 0.1;
+  A(2, 1) = 0.3;
+  S21Matrix expected = A;
+  for (int i = 1; i < 13; ++i) expected *= A;
+
+  EXPECT_TRUE(A.Pow(13).Compare(expected, 1e-12).equal);
+}
+
+TEST(PowTest, NegativeExponent) {
+  S21Matrix F = Fibonacci();
+
+  S21Matrix P = F.Pow(-3) * F.Pow(3);
+
+  EXPECT_NEAR(P(0, 0), 1.0, 1e-12);
+  EXPECT_NEAR(P(0, 1), 0.0, 1e-12);
+  EXPECT_THROW(S21Matrix(2, 2).Pow(-1), std::logic_error);
+}
+
+TEST(PowTest, EigenMethod) {
+  S21Matrix F = Fibonacci();
+
+  S21Matrix P = F.Pow(20, S21PowMethod::kEigen);
+
+  EXPECT_NEAR(P(0, 1), 6765.0, 1e-8);
+  EXPECT_TRUE(F.Pow(-2, S21PowMethod::kEigen)
+                  .Compare(F.Pow(-2), 1e-10)
+                  .equal);
+}
+
+TEST(PowTest, Errors) {
+  S21Matrix A(2, 3);
+  S21Matrix B = Fibonacci();
+  B(0, 1) = 2;
+
+  EXPECT_THROW(A.Pow(2), std::logic_error);
+  EXPECT_THROW(B.Pow(2, S21PowMethod::kEigen), std::logic_error);
+}
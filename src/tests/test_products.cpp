@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+#include "test_helpers.h"
+
+TEST(HadamardTest, ProductAndDivide) {
+  S21Matrix A = LinearMatrix(3, 70, 0.25);
+  S21Matrix B = LinearMatrix(3, 70, 100.0);
+
+  S21Matrix P = S21Matrix::HadamardProduct(A, B);
+  S21Matrix Q = S21Matrix::HadamardDivide(P, B);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 70; ++j) EXPECT_DOUBLE_EQ(P(i, j), A(i, j) * B(i, j));
+  }
+  EXPECT_TRUE(Q.EqMatrix(A));
+
+  S21Matrix C(A);
+  C.HadamardProduct(B);
+  EXPECT_TRUE(C.EqMatrix(P));
+  C.HadamardDivide(B);
+  EXPECT_TRUE(C.EqMatrix(A));
+  EXPECT_DOUBLE_EQ(A(0, 0), 0.75);
+}
+
+TEST(HadamardTest, SelfAndErrors) {
+  S21Matrix A = LinearMatrix(2, 2, 1.0);
+  S21Matrix squared = S21Matrix::HadamardProduct(A, A);
+  A.HadamardProduct(A);
+  EXPECT_TRUE(A.EqMatrix(squared));
+
+  S21Matrix Z(2, 2);
+  S21Matrix inf = S21Matrix::HadamardDivide(A, Z);
+  EXPECT_TRUE(std::isinf(inf(0, 0)));
+  EXPECT_THROW(A.HadamardProduct(S21Matrix(2, 3)), std::logic_error);
+  EXPECT_THROW(S21Matrix::HadamardDivide(A, S21Matrix(3, 2)),
+               std::logic_error);
+}
+
+TEST(KroneckerTest, Blocks) {
+  S21Matrix A(2, 2);
+  A(0, 0) = 1;
+  A(0, 1) = 2;
+  A(1, 0) = 3;
+  A(1, 1) = 4;
+  S21Matrix B = LinearMatrix(2, 3, 0.0);
+
+  S21Matrix K = S21Matrix::Kronecker(A, B);
+  ASSERT_EQ(K.GetRows(), 4);
+  ASSERT_EQ(K.GetCols(), 6);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      EXPECT_DOUBLE_EQ(K(i, j), A(i / 2, j / 3) * B(i % 2, j % 3));
+    }
+  }
+}
+
+TEST(KroneckerTest, StreamingLargeProduct) {
+  // 1.5 МБ * 8 — больше порога записи в обход кэша
+  S21Matrix A = LinearMatrix(40, 33, 0.5);
+  S21Matrix B = LinearMatrix(25, 31, -0.5);
+
+  S21Matrix K = S21Matrix::Kronecker(A, B);
+  EXPECT_DOUBLE_EQ(K(999, 1022), A(39, 32) * B(24, 30));
+  EXPECT_DOUBLE_EQ(K(517, 300), A(20, 9) * B(17, 21));
+}
+
+TEST(KroneckerTest, LazyOperator) {
+  for (int shape = 0; shape < 2; ++shape) {
+    S21Matrix A = LinearMatrix(shape ? 5 : 2, 3, 0.5);
+    S21Matrix B = LinearMatrix(4, shape ? 2 : 6, -1.0);
+    S21Matrix K = S21Matrix::Kronecker(A, B);
+    S21Vector x(K.GetCols());
+    for (int k = 0; k < x.GetSize(); ++k) x(k) = std::sin(k + 1.0);
+
+    S21LinearOperator op = S21Matrix::KroneckerOperator(A, B);
+    A(0, 0) = 1e6;  // оператор держит свою копию
+    S21Vector y(K.GetRows());
+    op(x, y);
+
+    EXPECT_TRUE(y.EqVector(K.MulVector(x)));
+    S21Vector wrong(3);
+    EXPECT_THROW(op(wrong, y), std::logic_error);
+  }
+}
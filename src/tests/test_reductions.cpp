@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+#include "test_helpers.h"
+
+static S21Matrix PeriodicMatrix(int rows, int cols) {
+  return FillMatrix(rows, cols, [](int i, int j) {
+    return (i % 7) * 0.5 - (j % 5) + 0.25;
+  });
+}
+
+TEST(ReductionsTest, SmallMatrix) {
+  S21Matrix A(2, 3);
+  A(0, 0) = 1.0;
+  A(0, 1) = -2.0;
+  A(0, 2) = 3.0;
+  A(1, 0) = -4.0;
+  A(1, 1) = 5.0;
+  A(1, 2) = -6.0;
+
+  EXPECT_DOUBLE_EQ(A.Sum(), -3.0);
+  EXPECT_DOUBLE_EQ(A.FrobeniusNorm(), std::sqrt(91.0));
+  EXPECT_DOUBLE_EQ(A.Norm1(), 9.0);
+  EXPECT_DOUBLE_EQ(A.NormInf(), 15.0);
+  EXPECT_DOUBLE_EQ(A.MaxAbs(), 6.0);
+
+  S21Extremum lo = A.ArgMin(), hi = A.ArgMax();
+  EXPECT_DOUBLE_EQ(lo.value, -6.0);
+  EXPECT_EQ(lo.row, 1);
+  EXPECT_EQ(lo.col, 2);
+  EXPECT_DOUBLE_EQ(hi.value, 5.0);
+  EXPECT_EQ(hi.row, 1);
+  EXPECT_EQ(hi.col, 1);
+
+  EXPECT_THROW(A.Trace(), std::logic_error);
+  S21Matrix B = PeriodicMatrix(4, 4);
+  EXPECT_DOUBLE_EQ(B.Trace(), B(0, 0) + B(1, 1) + B(2, 2) + B(3, 3));
+}
+
+TEST(ReductionsTest, LargeMatchesReference) {
+  // Несколько блоков строк и строки с отступом до кэш-линии
+  S21Matrix A = PeriodicMatrix(700, 130);
+  double sum = 0.0, squares = 0.0, max_row = 0.0, max_abs = 0.0;
+  std::vector<double> cols(130, 0.0);
+  for (int i = 0; i < 700; ++i) {
+    double row = 0.0;
+    for (int j = 0; j < 130; ++j) {
+      sum += A(i, j);
+      squares += A(i, j) * A(i, j);
+      row += std::fabs(A(i, j));
+      cols[j] += std::fabs(A(i, j));
+      max_abs = std::max(max_abs, std::fabs(A(i, j)));
+    }
+    max_row = std::max(max_row, row);
+  }
+  double max_col = *std::max_element(cols.begin(), cols.end());
+
+  for (S21Summation mode : {S21Summation::kPlain, S21Summation::kPairwise,
+                            S21Summation::kKahan}) {
+    EXPECT_NEAR(A.Sum(mode), sum, 1e-9);
+    EXPECT_NEAR(A.FrobeniusNorm(mode), std::sqrt(squares), 1e-9);
+  }
+  EXPECT_NEAR(A.Norm1(), max_col, 1e-9);
+  EXPECT_NEAR(A.NormInf(), max_row, 1e-9);
+  EXPECT_DOUBLE_EQ(A.MaxAbs(), max_abs);
+
+  // Первое вхождение при равных значениях
+  S21Extremum lo = A.ArgMin();
+  EXPECT_EQ(lo.row, 0);
+  EXPECT_EQ(lo.col, 4);
+  A(650, 100) = 1e3;
+  S21Extremum hi = A.ArgMax();
+  EXPECT_EQ(hi.row, 650);
+  EXPECT_EQ(hi.col, 100);
+}
+
+TEST(ReductionsTest, CompensatedSummation) {
+  // 1 + n * 1e-16: простая сумма теряет малые слагаемые
+  S21Matrix A(1, 100001);
+  A(0, 0) = 1.0;
+  for (int j = 1; j < 100001; ++j) A(0, j) = 1e-16;
+  EXPECT_DOUBLE_EQ(A.Sum(S21Summation::kKahan), 1.0 + 1e-11);
+  EXPECT_NEAR(A.Sum(S21Summation::kPairwise), 1.0 + 1e-11, 1e-15);
+
+  // Слагаемое больше накопленной суммы
+  S21Matrix B(1, 4);
+  B(0, 0) = 1.0;
+  B(0, 1) = 1e100;
+  B(0, 2) = 1.0;
+  B(0, 3) = -1e100;
+  EXPECT_DOUBLE_EQ(B.Sum(S21Summation::kKahan), 2.0);
+}
+
+TEST(ReductionsTest, FrobeniusScaling) {
+  S21Matrix A(2, 2);
+  A(0, 0) = 3e200;
+  A(1, 1) = -4e200;
+  EXPECT_DOUBLE_EQ(A.FrobeniusNorm(), 5e200);
+  A(0, 0) = 3e-200;
+  A(1, 1) = 4e-200;
+  EXPECT_DOUBLE_EQ(A.FrobeniusNorm(), 5e-200);
+  A(0, 0) = 0.0;
+  A(1, 1) = 0.0;
+  EXPECT_EQ(A.FrobeniusNorm(), 0.0);
+}
+
+TEST(ReductionsTest, NanHandling) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  S21Matrix A(2, 2);
+  A(0, 0) = nan;
+  A(0, 1) = 2.0;
+  A(1, 0) = -1.0;
+  A(1, 1) = nan;
+  EXPECT_EQ(A.ArgMin().col, 0);
+  EXPECT_EQ(A.ArgMin().row, 1);
+  EXPECT_EQ(A.ArgMax().col, 1);
+  EXPECT_TRUE(std::isnan(A.Sum()));
+
+  S21Matrix B(1, 1);
+  B(0, 0) = nan;
+  EXPECT_EQ(B.ArgMax().row, 0);
+  EXPECT_TRUE(std::isnan(B.ArgMax().value));
+}
+
+TEST(ReductionsTest, NormsPropagateNan) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  S21Matrix A(2, 2);
+  A(0, 0) = 1.0;
+  A(0, 1) = nan;
+  A(1, 0) = 2.0;
+  A(1, 1) = 3.0;
+  EXPECT_TRUE(std::isnan(A.Norm1()));
+  EXPECT_TRUE(std::isnan(A.NormInf()));
+  EXPECT_TRUE(std::isnan(A.MaxAbs()));
+  EXPECT_TRUE(std::isnan(A.FrobeniusNorm()));
+
+  // nan в последнем блоке большой матрицы и в нечётном хвосте строки
+  S21Matrix B(300, 301);
+  B(0, 0) = 5.0;
+  B(299, 300) = nan;
+  EXPECT_TRUE(std::isnan(B.Norm1()));
+  EXPECT_TRUE(std::isnan(B.NormInf()));
+  EXPECT_TRUE(std::isnan(B.MaxAbs()));
+}
+
+TEST(ReductionsTest, NormsWithInfinity) {
+  const double inf = std::numeric_limits<double>::infinity();
+  S21Matrix A(2, 2);
+  A(0, 0) = 1.0;
+  A(0, 1) = -inf;
+  A(1, 1) = inf;
+  EXPECT_EQ(A.Norm1(), inf);
+  EXPECT_EQ(A.NormInf(), inf);
+  EXPECT_EQ(A.MaxAbs(), inf);
+  EXPECT_EQ(A.FrobeniusNorm(), inf);
+}
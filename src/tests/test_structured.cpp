@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../s21_structured.h"
+#include "test_helpers.h"
+
+static S21Vector MakeVector(int n) {
+  S21Vector x(n);
+  for (int i = 0; i < n; ++i) x(i) = i - 1.5;
+  return x;
+}
+
+TEST(DiagonalMatrixTest, Products) {
+  S21DiagonalMatrix D(3);
+  D(0) = 2;
+  D(1) = -1;
+  D(2) = 0.5;
+  S21Matrix A = LinearMatrix(3, 3);
+
+  EXPECT_TRUE((D * A).EqMatrix(D.ToDense() * A));
+  EXPECT_TRUE((A * D).EqMatrix(A * D.ToDense()));
+  EXPECT_TRUE(D.MulVector(MakeVector(3))
+                  .EqVector(D.ToDense().MulVector(MakeVector(3))));
+  EXPECT_DOUBLE_EQ(D.Determinant(), -1.0);
+  EXPECT_DOUBLE_EQ(D(0, 1), 0.0);
+}
+
+TEST(DiagonalMatrixTest, Solve) {
+  S21DiagonalMatrix D(3);
+  D(0) = 2;
+  D(1) = -1;
+  D(2) = 0.5;
+  S21Matrix b = LinearMatrix(3, 2);
+
+  EXPECT_TRUE((D * D.Solve(b)).EqMatrix(b));
+  D(1) = 0;
+  EXPECT_THROW(D.Solve(b), std::logic_error);
+}
+
+TEST(DiagonalMatrixTest, Errors) {
+  EXPECT_THROW(S21DiagonalMatrix(0), std::invalid_argument);
+  S21DiagonalMatrix D(2);
+  EXPECT_THROW(D(2), std::out_of_range);
+  EXPECT_THROW(D * LinearMatrix(3, 2), std::logic_error);
+}
+
+TEST(TriangularMatrixTest, LowerAndUpper) {
+  for (bool upper : {false, true}) {
+    S21TriangularMatrix T(4, upper);
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        if (upper ? j >= i : j <= i) T(i, j) = (i == j) ? 3.0 : i - j + 0.5;
+      }
+    }
+    S21Matrix dense = T.ToDense();
+    S21Matrix b = LinearMatrix(4, 3);
+
+    EXPECT_TRUE(T.MulMatrix(b).EqMatrix(dense * b));
+    EXPECT_TRUE(T.MulVector(MakeVector(4))
+                    .EqVector(dense.MulVector(MakeVector(4))));
+    EXPECT_TRUE(T.Solve(b).EqMatrix(dense.Solve(b)));
+    EXPECT_NEAR(T.Determinant(), 81.0, 1e-12);
+  }
+}
+
+TEST(TriangularMatrixTest, OutsideTriangle) {
+  S21TriangularMatrix L(3, false);
+  const S21TriangularMatrix& view = L;
+
+  EXPECT_DOUBLE_EQ(view(0, 2), 0.0);
+  EXPECT_THROW(L(0, 2), std::out_of_range);
+  EXPECT_THROW(L.Solve(LinearMatrix(3, 1)), std::logic_error);
+}
+
+TEST(TriangularMatrixTest, ZeroTimesInfinity) {
+  // Нулевой элемент внутри треугольника: 0 * inf даёт nan, как в Gemm
+  S21TriangularMatrix L(2, false);
+  L(0, 0) = 1.0;
+  L(1, 1) = 1.0;
+  S21Matrix b(2, 1);
+  b(0, 0) = std::numeric_limits<double>::infinity();
+  b(1, 0) = 1.0;
+
+  EXPECT_TRUE(std::isnan(L.MulMatrix(b)(1, 0)));
+  EXPECT_TRUE(std::isnan((L.ToDense() * b)(1, 0)));
+  EXPECT_TRUE(std::isnan(L.Solve(b)(1, 0)));
+  b(0, 0) = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(L.MulMatrix(b)(1, 0)));
+}
+
+TEST(SymmetricMatrixTest, PositiveDefinite) {
+  S21SymmetricMatrix S(4);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j <= i; ++j) S(i, j) = (i == j) ? 5.0 : 1.0 / (i + j);
+  }
+  S21Matrix dense = S.ToDense();
+  S21Matrix b = LinearMatrix(4, 2);
+
+  EXPECT_DOUBLE_EQ(S(0, 3), S(3, 0));
+  EXPECT_TRUE(S.MulMatrix(b).EqMatrix(dense * b));
+  EXPECT_TRUE(S.MulVector(MakeVector(4))
+                  .EqVector(dense.MulVector(MakeVector(4))));
+  EXPECT_TRUE(S.Solve(b).EqMatrix(dense.Solve(b)));
+  EXPECT_NEAR(S.Determinant(), dense.Determinant(), 1e-9);
+}
+
+TEST(SymmetricMatrixTest, IndefiniteFallsBackToLu) {
+  S21SymmetricMatrix S(3);
+  S(0, 0) = 1;
+  S(1, 0) = 2;
+  S(1, 1) = 1;
+  S(2, 2) = -3;
+  S21Matrix b = LinearMatrix(3, 1);
+
+  EXPECT_TRUE(S.Solve(b).EqMatrix(S.ToDense().Solve(b)));
+  EXPECT_NEAR(S.Determinant(), 9.0, 1e-12);
+}
+
+TEST(BandedMatrixTest, Tridiagonal) {
+  const int n = 50;
+  S21BandedMatrix B(n, 1, 1);
+  for (int i = 0; i < n; ++i) {
+    B(i, i) = (i % 3 == 0) ? 0.0 : 2.0;  // нулевые ведущие: нужен выбор
+    if (i > 0) B(i, i - 1) = -1.0;
+    if (i + 1 < n) B(i, i + 1) = 1.5;
+  }
+  S21Matrix dense = B.ToDense();
+  S21Matrix b = LinearMatrix(n, 2);
+
+  EXPECT_TRUE(B.MulMatrix(b).EqMatrix(dense * b));
+  EXPECT_TRUE(B.MulVector(MakeVector(n))
+                  .EqVector(dense.MulVector(MakeVector(n))));
+  EXPECT_TRUE(B.Solve(b).EqMatrix(dense.Solve(b)));
+  EXPECT_NEAR(B.Determinant() / dense.Determinant(), 1.0, 1e-9);
+}
+
+TEST(BandedMatrixTest, WideBand) {
+  S21BandedMatrix B(6, 2, 1);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = std::max(0, i - 2); j <= std::min(5, i + 1); ++j) {
+      B(i, j) = 1.0 + i * 0.3 - j * 0.7;
+    }
+  }
+  S21Matrix dense = B.ToDense();
+  S21Matrix b = LinearMatrix(6, 3);
+
+  EXPECT_TRUE(B.Solve(b).EqMatrix(dense.Solve(b)));
+  EXPECT_NEAR(B.Determinant(), dense.Determinant(), 1e-9);
+}
+
+TEST(BandedMatrixTest, ZeroTimesInfinity) {
+  S21BandedMatrix B(2, 1, 1);
+  B(0, 0) = 1.0;
+  B(1, 1) = 1.0;
+  S21Matrix b(2, 1);
+  b(0, 0) = std::numeric_limits<double>::infinity();
+  b(1, 0) = 1.0;
+
+  EXPECT_TRUE(std::isnan(B.MulMatrix(b)(1, 0)));
+  EXPECT_TRUE(std::isnan(B.Solve(b)(1, 0)));
+  b(0, 0) = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(B.MulMatrix(b)(1, 0)));
+}
+
+TEST(BandedMatrixTest, Errors) {
+  EXPECT_THROW(S21BandedMatrix(3, -1, 0), std::invalid_argument);
+  EXPECT_THROW(S21BandedMatrix(3, 0, 3), std::invalid_argument);
+  S21BandedMatrix B(3, 0, 1);
+  EXPECT_THROW(B(1, 0), std::out_of_range);
+  EXPECT_DOUBLE_EQ(static_cast<const S21BandedMatrix&>(B)(2, 0), 0.0);
+  EXPECT_THROW(B.Solve(LinearMatrix(3, 1)), std::logic_error);
+  EXPECT_DOUBLE_EQ(B.Determinant(), 0.0);
+}
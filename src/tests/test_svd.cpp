@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+#include "test_helpers.h"
+
+// U diag(sigma) V^T
+static S21Matrix Reconstruct(const S21SvdResult& svd) {
+  S21Matrix scaled(svd.u);
+  for (int i = 0; i < scaled.GetRows(); ++i) {
+    for (int j = 0; j < scaled.GetCols(); ++j) scaled(i, j) *= svd.sigma(j);
+  }
+  return scaled * svd.vt;
+}
+
+TEST(SvdTest, QRFactors) {
+  for (auto [rows, cols] : {std::pair{9, 5}, std::pair{4, 7}}) {
+    S21Matrix a = RandomMatrix(rows, cols, rows);
+    S21QRResult qr = a.QR();
+    int p = std::min(rows, cols);
+    ASSERT_EQ(qr.q.GetRows(), rows);
+    ASSERT_EQ(qr.q.GetCols(), p);
+    ASSERT_EQ(qr.r.GetRows(), p);
+    ExpectNearMatrix(qr.q.Transpose() * qr.q, Identity(p), 1e-13);
+    ExpectNearMatrix(qr.q * qr.r, a, 1e-13);
+    for (int i = 0; i < p; ++i) {
+      for (int j = 0; j < i; ++j) EXPECT_EQ(qr.r(i, j), 0.0);
+    }
+  }
+}
+
+TEST(SvdTest, LowRankRecoversExactRank) {
+  S21Matrix a = RandomMatrix(80, 6, 1) * RandomMatrix(6, 60, 2);
+  S21SvdResult svd = a.LowRank(6);
+  ExpectNearMatrix(Reconstruct(svd), a, 1e-10);
+  ExpectNearMatrix(svd.u.Transpose() * svd.u, Identity(6), 1e-12);
+  ExpectNearMatrix(svd.vt * svd.vt.Transpose(), Identity(6), 1e-12);
+
+  // sigma^2 — собственные значения A^T A
+  S21EigenResult eigen = (a.Transpose() * a).EigenSymmetric();
+  for (int j = 0; j < 6; ++j) {
+    EXPECT_NEAR(svd.sigma(j), std::sqrt(eigen.values(j)),
+                1e-10 * svd.sigma(0));
+    if (j > 0) {
+      EXPECT_LE(svd.sigma(j), svd.sigma(j - 1));
+    }
+  }
+}
+
+TEST(SvdTest, LowRankTruncatesDecayingSpectrum) {
+  // A = X diag(2^-j) Y^T с ортонормированными X и Y
+  const int n = 70;
+  S21Matrix x = RandomMatrix(n, n, 3).QR().q;
+  S21Matrix y = RandomMatrix(n, n, 4).QR().q;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) x(i, j) *= std::pow(0.5, j);
+  }
+  S21Matrix a = x * y.Transpose();
+
+  S21SvdResult svd = a.LowRank(5);
+  for (int j = 0; j < 5; ++j) {
+    EXPECT_NEAR(svd.sigma(j), std::pow(0.5, j), 1e-10);
+  }
+  S21Matrix error = a - Reconstruct(svd);
+  // Лучшее приближение ранга 5 ошибается на sigma_6 = 2^-5
+  double frobenius = error.FrobeniusNorm();
+  EXPECT_GE(frobenius, std::pow(0.5, 5) * (1.0 - 1e-8));
+  EXPECT_LE(frobenius, std::pow(0.5, 5) * 1.2);
+}
+
+TEST(SvdTest, SeedIsReproducible) {
+  S21Matrix a = RandomMatrix(50, 40, 5);
+  S21LowRankOptions options;
+  options.seed = 7;
+  options.power_iterations = 1;
+  S21SvdResult first = a.LowRank(4, options), second = a.LowRank(4, options);
+  EXPECT_TRUE(first.u.EqMatrix(second.u));
+  EXPECT_TRUE(first.vt.EqMatrix(second.vt));
+  EXPECT_EQ(first.sigma, second.sigma);
+
+  EXPECT_THROW(a.LowRank(0), std::invalid_argument);
+  EXPECT_THROW(a.LowRank(41), std::invalid_argument);
+  options.oversampling = -1;
+  EXPECT_THROW(a.LowRank(3, options), std::invalid_argument);
+}
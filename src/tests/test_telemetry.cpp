@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_telemetry.h"
+
+static S21OpStats Find(S21Op op) {
+  return S21Telemetry::Snapshot()[static_cast<int>(op)];
+}
+
+TEST(TelemetryTest, DisabledRecordsNothing) {
+  S21Telemetry::SetEnabled(false);
+  S21Telemetry::Reset();
+
+  S21Matrix A(4, 4);
+  A.MulMatrix(A);
+
+  EXPECT_EQ(Find(S21Op::kMulMatrix).calls, 0u);
+  EXPECT_TRUE(S21Telemetry::Dump().empty());
+}
+
+TEST(TelemetryTest, CountsCalls) {
+  S21Telemetry::SetEnabled(true);
+  S21Telemetry::Reset();
+
+  S21Matrix A(4, 5);
+  S21Matrix B(5, 2);
+  A.MulMatrix(B);
+  A.MulMatrix(S21Matrix(2, 2));
+  S21Matrix C(A);
+  S21Telemetry::SetEnabled(false);
+
+  S21OpStats mul = Find(S21Op::kMulMatrix);
+  S21OpStats create = Find(S21Op::kCreateMatrix);
+  if (S21Telemetry::kCompiled) {
+    EXPECT_EQ(mul.calls, 2u);
+    EXPECT_EQ(mul.elements, 16u);
+    EXPECT_GE(mul.total_ns, mul.max_ns);
+    EXPECT_GE(create.calls, 5u);
+    EXPECT_GE(create.bytes, 20 * sizeof(double));
+    EXPECT_EQ(mul.bytes, 0u);  // трафик Gemm не смешивается с выделением
+    EXPECT_EQ(Find(S21Op::kCopy).calls, 1u);
+    EXPECT_NE(S21Telemetry::Dump().find("op=\"MulMatrix\""),
+              std::string::npos);
+  } else {
+    EXPECT_FALSE(S21Telemetry::IsEnabled());
+    EXPECT_EQ(mul.calls, 0u);
+  }
+  EXPECT_STREQ(mul.name, "MulMatrix");
+}
+
+TEST(TelemetryTest, AggregatesFinishedThreads) {
+  S21Telemetry::SetEnabled(true);
+  S21Telemetry::Reset();
+
+  std::thread worker([] {
+    S21Matrix A(3, 3);
+    A.Transpose();
+  });
+  worker.join();
+  S21Telemetry::SetEnabled(false);
+
+  EXPECT_EQ(Find(S21Op::kTranspose).calls,
+            S21Telemetry::kCompiled ? 1u : 0u);
+}
+
+TEST(TelemetryTest, ResetLeavesLiveThreadsToTheirOwners) {
+  S21Telemetry::SetEnabled(true);
+  S21Telemetry::Reset();
+
+  // Поток жив во время сброса: его счётчики скрыты из снимка, пока
+  // он сам не обнулит их при следующей записи
+  std::atomic<int> stage{0};
+  std::thread worker([&stage] {
+    S21Matrix A(3, 3);
+    A.Transpose();
+    stage = 1;
+    while (stage != 2) std::this_thread::yield();
+    A.Transpose();
+    stage = 3;
+    while (stage != 4) std::this_thread::yield();
+  });
+  while (stage != 1) std::this_thread::yield();
+  unsigned expected = S21Telemetry::kCompiled ? 1u : 0u;
+  EXPECT_EQ(Find(S21Op::kTranspose).calls, expected);
+  S21Telemetry::Reset();
+  EXPECT_EQ(Find(S21Op::kTranspose).calls, 0u);
+  stage = 2;
+  while (stage != 3) std::this_thread::yield();
+  EXPECT_EQ(Find(S21Op::kTranspose).calls, expected);
+  stage = 4;
+  worker.join();
+  S21Telemetry::SetEnabled(false);
+  EXPECT_EQ(Find(S21Op::kTranspose).calls, expected);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_structured.h"
+#include "../s21_task_dag.h"
+#include "../s21_tiled.h"
+#include "test_helpers.h"
+
+static std::vector<double*> Rows(S21Matrix& m) {
+  std::vector<double*> rows(m.GetRows());
+  for (int i = 0; i < m.GetRows(); ++i) rows[i] = m.Row(i);
+  return rows;
+}
+
+TEST(TaskDagTest, DependenciesFollowBlocks) {
+  std::mutex mutex;
+  std::vector<int> order;
+  auto log = [&](int id) {
+    return [&, id] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(id);
+    };
+  };
+  S21TaskDag dag;
+  dag.Add(log(0), {}, {0});
+  dag.Add(log(1), {0}, {1});
+  dag.Add(log(2), {0}, {2});
+  dag.Add(log(3), {1, 2}, {0});  // запись после чтений блока 0
+  dag.Add(log(4), {}, {5}, true);
+  EXPECT_EQ(dag.Size(), 5);
+  dag.Run();
+  EXPECT_EQ(dag.Size(), 0);
+
+  ASSERT_EQ(order.size(), 5u);
+  std::vector<int> position(5);
+  for (int i = 0; i < 5; ++i) position[order[i]] = i;
+  EXPECT_LT(position[0], position[1]);
+  EXPECT_LT(position[0], position[2]);
+  EXPECT_LT(position[1], position[3]);
+  EXPECT_LT(position[2], position[3]);
+}
+
+TEST(TaskDagTest, ExceptionIsRethrown) {
+  S21TaskDag dag;
+  bool skipped = true;
+  dag.Add([] { throw std::runtime_error("task failed"); }, {}, {0});
+  dag.Add([&] { skipped = false; }, {0}, {1});
+  EXPECT_THROW(dag.Run(), std::runtime_error);
+  EXPECT_TRUE(skipped);
+  EXPECT_THROW(dag.Add([] {}, {-1}, {}), std::out_of_range);
+}
+
+TEST(TiledTest, LUReconstructsMatrix) {
+  const int n = 150;
+  S21Matrix a = RandomMatrix(n, n);
+  S21Matrix lu(a);
+  std::vector<double*> rows = Rows(lu);
+  std::vector<int> pivots(n);
+  ASSERT_TRUE(S21Tiled::LU(rows.data(), n, pivots.data(), 1e-12, 32));
+
+  S21Matrix l(n, n), u(n, n), pa(a);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      if (j < i) l(i, j) = lu(i, j);
+      if (j >= i) u(i, j) = lu(i, j);
+    }
+    l(i, i) = 1.0;
+  }
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) std::swap(pa(k, j), pa(pivots[k], j));
+  }
+  S21Matrix product = l * u;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) EXPECT_NEAR(product(i, j), pa(i, j), 1e-10);
+  }
+
+  double det = 1.0;
+  for (int k = 0; k < n; ++k) det *= pivots[k] != k ? -lu(k, k) : lu(k, k);
+  EXPECT_NEAR(det, a.Determinant(), 1e-9 * std::fabs(det));
+}
+
+TEST(TiledTest, LUDetectsSingular) {
+  const int n = 70;
+  S21Matrix a = RandomMatrix(n, n);
+  for (int j = 0; j < n; ++j) a(40, j) = a(3, j);
+  std::vector<double*> rows = Rows(a);
+  std::vector<int> pivots(n);
+  EXPECT_FALSE(S21Tiled::LU(rows.data(), n, pivots.data(), 1e-10, 16));
+  EXPECT_THROW(S21Tiled::LU(rows.data(), n, pivots.data(), 0.0, 0),
+               std::invalid_argument);
+}
+
+TEST(TiledTest, CholeskyReconstructsMatrix) {
+  const int n = 130;
+  S21SymmetricMatrix s(n);
+  S21Matrix a(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      double value = i == j ? n : std::cos(i * 0.3 + j);
+      s(i, j) = value;
+      a(i, j) = value;
+      if (j < i) a(j, i) = -1.0;  // верхний треугольник не читается
+    }
+  }
+  std::vector<double*> rows = Rows(a);
+  ASSERT_TRUE(S21Tiled::Cholesky(rows.data(), n, 24));
+
+  S21Matrix l(n, n);
+  double det = 1.0;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) l(i, j) = a(i, j);
+    if (i + 1 < n) {
+      EXPECT_EQ(a(i, i + 1), -1.0);
+    }
+    det *= a(i, i) * a(i, i);
+  }
+  S21Matrix product = l * l.Transpose();
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) EXPECT_NEAR(product(i, j), s(i, j), 1e-10);
+  }
+  EXPECT_NEAR(det, s.Determinant(), 1e-9 * det);
+
+  S21Matrix indefinite = RandomMatrix(50, 50);
+  rows = Rows(indefinite);
+  EXPECT_FALSE(S21Tiled::Cholesky(rows.data(), 50, 16));
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_vector.h"
+#include "test_helpers.h"
+
+static S21Matrix DiagonallyDominant(int n) {
+  return FillMatrix(n, n, [n](int i, int j) {
+    return i == j ? n + 2.0 : std::sin(i * 1.3 + j * 0.7);
+  });
+}
+
+TEST(UpdateTest, RankOneMatchesRecompute) {
+  S21Matrix m = DiagonallyDominant(12);
+  m.InverseMatrix();
+  S21Vector u(12), v(12);
+  for (int i = 0; i < 12; ++i) {
+    u(i) = 0.1 * i - 0.4;
+    v(i) = std::cos(i * 0.9);
+  }
+  EXPECT_TRUE(m.RankOneUpdate(u, v));
+
+  S21Matrix fresh(m);
+  fresh.SetCacheEnabled(false);
+  ExpectNearMatrix(m.InverseMatrix(), fresh.InverseMatrix(), 1e-10);
+  EXPECT_NEAR(m.Determinant(), fresh.Determinant(),
+              1e-10 * std::fabs(fresh.Determinant()));
+}
+
+TEST(UpdateTest, LowRankMatchesRecompute) {
+  S21Matrix m = DiagonallyDominant(16);
+  double det = m.Determinant();  // в кэше только LU
+  S21Matrix u(16, 3), c(3, 3), v(16, 3);
+  for (int i = 0; i < 16; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      u(i, j) = std::sin(i + 2.0 * j);
+      v(i, j) = std::cos(i * j + 0.5);
+    }
+  }
+  for (int i = 0; i < 3; ++i) c(i, i) = 0.5 + i;
+  c(0, 2) = 0.25;
+  EXPECT_TRUE(m.LowRankUpdate(u, c, v));
+  EXPECT_NE(m.Determinant(), det);
+
+  S21Matrix fresh(m);
+  fresh.SetCacheEnabled(false);
+  EXPECT_NEAR(m.Determinant(), fresh.Determinant(),
+              1e-10 * std::fabs(fresh.Determinant()));
+  // Решение идёт через старое LU и поправку к нему
+  ExpectNearMatrix(m.Solve(u), fresh.Solve(u), 1e-10);
+  EXPECT_TRUE(m.LowRankUpdate(u, c, v));
+  fresh = m;
+  fresh.SetCacheEnabled(false);
+  ExpectNearMatrix(m.Solve(u), fresh.Solve(u), 1e-10);
+  ExpectNearMatrix(m.InverseMatrix(), fresh.InverseMatrix(), 1e-10);
+
+  // Повторные поправки продолжают работать через обратную матрицу
+  for (int step = 0; step < 5; ++step) {
+    EXPECT_TRUE(m.LowRankUpdate(u, c, v));
+    c.MulNumber(-0.5);
+  }
+  fresh = m;
+  fresh.SetCacheEnabled(false);
+  ExpectNearMatrix(m.InverseMatrix(), fresh.InverseMatrix(), 1e-9);
+}
+
+TEST(UpdateTest, ReplaceRow) {
+  S21Matrix m = DiagonallyDominant(8);
+  m.InverseMatrix();
+  S21Vector row(8);
+  for (int j = 0; j < 8; ++j) row(j) = j == 3 ? 5.0 : 0.5 * j;
+  EXPECT_TRUE(m.ReplaceRow(3, row));
+  for (int j = 0; j < 8; ++j) EXPECT_EQ(m(3, j), row(j));
+
+  S21Matrix fresh(m);
+  fresh.SetCacheEnabled(false);
+  ExpectNearMatrix(m.InverseMatrix(), fresh.InverseMatrix(), 1e-12);
+  EXPECT_THROW(m.ReplaceRow(8, row), std::out_of_range);
+  EXPECT_THROW(m.ReplaceRow(0, S21Vector(7)), std::logic_error);
+}
+
+TEST(UpdateTest, UnsafeUpdateRecomputes) {
+  S21Matrix m(3, 3);
+  m(0, 0) = 1;
+  m(1, 1) = 2;
+  m(2, 2) = 4;
+  m.InverseMatrix();
+  // Строка 0 становится равной строке 1: матрица вырождается,
+  // 1 + v^T A^{-1} u обращается в ноль
+  S21Vector row(3);
+  row(1) = 2;
+  EXPECT_FALSE(m.ReplaceRow(0, row));
+  EXPECT_DOUBLE_EQ(m.Determinant(), 0.0);
+  EXPECT_THROW(m.InverseMatrix(), std::logic_error);
+
+  // Почти вырожденный результат тоже считается заново
+  S21Matrix near = DiagonallyDominant(4);
+  near.InverseMatrix();
+  S21Vector first(4);
+  for (int j = 0; j < 4; ++j) first(j) = near(1, j) * (1.0 + 1e-12);
+  EXPECT_FALSE(near.ReplaceRow(0, first));
+  S21Matrix fresh(near);
+  fresh.SetCacheEnabled(false);
+  EXPECT_DOUBLE_EQ(near.Determinant(), fresh.Determinant());
+}
+
+TEST(UpdateTest, WithoutCache) {
+  S21Matrix m = DiagonallyDominant(5);
+  S21Vector u(5), v(5);
+  u(0) = 1;
+  v(4) = 2;
+  EXPECT_FALSE(m.RankOneUpdate(u, v));  // кэша ещё нет
+  EXPECT_EQ(m(0, 4), DiagonallyDominant(5)(0, 4) + 2.0);
+
+  m.SetCacheEnabled(false);
+  m.InverseMatrix();
+  EXPECT_FALSE(m.RankOneUpdate(u, v));
+
+  S21Matrix rect(2, 3);
+  EXPECT_THROW(rect.RankOneUpdate(S21Vector(2), S21Vector(3)),
+               std::logic_error);
+  EXPECT_THROW(m.LowRankUpdate(S21Matrix(5, 2), S21Matrix(2, 2),
+                               S21Matrix(4, 2)),
+               std::logic_error);
+}
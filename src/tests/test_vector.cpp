@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include "../s21_vector.h"
+
+TEST(VectorTest, Constructor) {
+  S21Vector v(4);
+
+  EXPECT_EQ(v.GetSize(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_DOUBLE_EQ(v(i), 0.0);
+}
+
+TEST(VectorTest, InvalidSize) {
+  EXPECT_THROW(S21Vector v(0), std::invalid_argument);
+}
+
+TEST(VectorTest, CopyAndMove) {
+  S21Vector v(3);
+  v(1) = 2.5;
+
+  S21Vector copy(v);
+  S21Vector moved(std::move(v));
+
+  EXPECT_TRUE(copy == moved);
+  EXPECT_EQ(v.GetSize(), 0);
+  EXPECT_EQ(v.Data(), nullptr);
+}
+
+TEST(VectorTest, Assignment) {
+  S21Vector v(2);
+  v.Fill(3.0);
+  S21Vector w(5);
+  w = v;
+
+  EXPECT_EQ(w.GetSize(), 2);
+  EXPECT_DOUBLE_EQ(w(1), 3.0);
+}
+
+TEST(VectorTest, IndexOutOfRange) {
+  S21Vector v(2);
+  const S21Vector& c = v;
+
+  EXPECT_THROW(v(2), std::out_of_range);
+  EXPECT_THROW(c(-1), std::out_of_range);
+}
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "s21_task_dag.h"
+#include "s21_tiled.h"
+
+namespace {
+
+double Dot(const double* a, const double* b, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    s0 += a[j] * b[j];
+    s1 += a[j + 1] * b[j + 1];
+    s2 += a[j + 2] * b[j + 2];
+    s3 += a[j + 3] * b[j + 3];
+  }
+  for (; j < n; ++j) s0 += a[j] * b[j];
+  return (s0 + s1) + (s2 + s3);
+}
+
+// y -= alpha * x
+void SubScaled(double alpha, const double* x, double* y, int n) {
+  for (int j = 0; j < n; ++j) y[j] -= alpha * x[j];
+}
+
+// Разбиение на тайлы и номера тайлов как блоков данных графа
+struct Tiling {
+  int n, tile, count;
+  int Begin(int b) const { return b * tile; }
+  int End(int b) const { return std::min(n, (b + 1) * tile); }
+  int Id(int i, int j) const { return i * count + j; }
+  // Тайлы столбца j начиная со строки тайлов from
+  std::vector<int> Column(int j, int from) const {
+    std::vector<int> ids;
+    for (int i = from; i < count; ++i) ids.push_back(Id(i, j));
+    return ids;
+  }
+};
+
+Tiling MakeTiling(int n, int tile) {
+  if (n < 1 || tile < 1) {
+    throw std::invalid_argument("Matrix and tile sizes must be positive");
+  }
+  return {n, tile, (n + tile - 1) / tile};
+}
+
+// LU панели: столбцы [c0, c1) от строки c0 до конца. Перестановки
+// строк касаются только столбцов панели, остальные переставляет Swap
+bool Panel(double** a, int n, int c0, int c1, int* pivots, double tolerance) {
+  bool regular = true;
+  for (int c = c0; c < c1; ++c) {
+    int p = c;
+    for (int i = c + 1; i < n; ++i) {
+      if (std::fabs(a[i][c]) > std::fabs(a[p][c])) p = i;
+    }
+    pivots[c] = p;
+    if (p != c) std::swap_ranges(a[c] + c0, a[c] + c1, a[p] + c0);
+    if (std::fabs(a[c][c]) <= tolerance) {
+      regular = false;
+      continue;
+    }
+    for (int i = c + 1; i < n; ++i) {
+      double l = a[i][c] / a[c][c];
+      a[i][c] = l;
+      if (l != 0.0) SubScaled(l, a[c] + c + 1, a[i] + c + 1, c1 - c - 1);
+    }
+  }
+  return regular;
+}
+
+// Перестановки панели [r0, r1) в столбцах [c0, c1)
+void Swap(double** a, int r0, int r1, const int* pivots, int c0, int c1) {
+  for (int r = r0; r < r1; ++r) {
+    if (pivots[r] != r) {
+      std::swap_ranges(a[r] + c0, a[r] + c1, a[pivots[r]] + c0);
+    }
+  }
+}
+
+// U тайла (k, j): решение с единичной нижнетреугольной L тайла (k, k)
+void SolveUnitLower(double** a, int k0, int k1, int c0, int c1) {
+  for (int r = k0 + 1; r < k1; ++r) {
+    for (int q = k0; q < r; ++q) {
+      if (a[r][q] != 0.0) SubScaled(a[r][q], a[q] + c0, a[r] + c0, c1 - c0);
+    }
+  }
+}
+
+// A(i, j) -= L(i, k) U(k, j)
+void UpdateLU(double** a, int r0, int r1, int c0, int c1, int k0, int k1) {
+  for (int r = r0; r < r1; ++r) {
+    for (int q = k0; q < k1; ++q) {
+      if (a[r][q] != 0.0) SubScaled(a[r][q], a[q] + c0, a[r] + c0, c1 - c0);
+    }
+  }
+}
+
+// Холецкий диагонального тайла
+bool FactorDiagonal(double** a, int k0, int k1) {
+  for (int i = k0; i < k1; ++i) {
+    for (int j = k0; j <= i; ++j) {
+      double sum = a[i][j] - Dot(a[i] + k0, a[j] + k0, j - k0);
+      if (i == j) {
+        if (!(sum > 0.0)) return false;
+        a[i][i] = std::sqrt(sum);
+      } else {
+        a[i][j] = sum / a[j][j];
+      }
+    }
+  }
+  return true;
+}
+
+// L(i, k) = A(i, k) L(k, k)^{-T}
+void SolveLowerTransposed(double** a, int r0, int r1, int k0, int k1) {
+  for (int r = r0; r < r1; ++r) {
+    for (int c = k0; c < k1; ++c) {
+      a[r][c] = (a[r][c] - Dot(a[r] + k0, a[c] + k0, c - k0)) / a[c][c];
+    }
+  }
+}
+
+// A(i, j) -= L(i, k) L(j, k)^T; на диагональном тайле — нижняя половина
+void UpdateCholesky(double** a, int r0, int r1, int c0, int c1, int k0,
+                    int k1, bool diagonal) {
+  for (int r = r0; r < r1; ++r) {
+    int last = diagonal ? r + 1 : c1;
+    for (int c = c0; c < last; ++c) {
+      a[r][c] -= Dot(a[r] + k0, a[c] + k0, k1 - k0);
+    }
+  }
+}
+
+}  // namespace
+
+bool S21Tiled::LU(double** a, int n, int* pivots, double tolerance,
+                  int tile) {
+  Tiling t = MakeTiling(n, tile);
+  std::atomic<bool> regular{true};
+  S21TaskDag dag;
+  for (int k = 0; k < t.count; ++k) {
+    int k0 = t.Begin(k), k1 = t.End(k);
+    dag.Add(
+        [=, &regular] {
+          if (!Panel(a, n, k0, k1, pivots, tolerance)) regular = false;
+        },
+        {}, t.Column(k, k), true);
+    // Перестановки панели в уже разложенных столбцах слева, как
+    // итоговый laswp в getrf
+    for (int j = 0; j < k; ++j) {
+      int c0 = t.Begin(j), c1 = t.End(j);
+      dag.Add([=] { Swap(a, k0, k1, pivots, c0, c1); }, {t.Id(k, k)},
+              t.Column(j, k));
+    }
+    // Столбец k + 1 нужен следующей панели и считается в первую очередь
+    for (int j = k + 1; j < t.count; ++j) {
+      int c0 = t.Begin(j), c1 = t.End(j);
+      bool next = j == k + 1;
+      dag.Add(
+          [=] {
+            Swap(a, k0, k1, pivots, c0, c1);
+            SolveUnitLower(a, k0, k1, c0, c1);
+          },
+          {t.Id(k, k)}, t.Column(j, k), next);
+      for (int i = k + 1; i < t.count; ++i) {
+        int r0 = t.Begin(i), r1 = t.End(i);
+        dag.Add([=] { UpdateLU(a, r0, r1, c0, c1, k0, k1); },
+                {t.Id(i, k), t.Id(k, j)}, {t.Id(i, j)}, next);
+      }
+    }
+  }
+  dag.Run();
+  return regular;
+}
+
+bool S21Tiled::Cholesky(double** a, int n, int tile) {
+  Tiling t = MakeTiling(n, tile);
+  std::atomic<bool> definite{true};
+  S21TaskDag dag;
+  for (int k = 0; k < t.count; ++k) {
+    int k0 = t.Begin(k), k1 = t.End(k);
+    dag.Add(
+        [=, &definite] {
+          if (definite && !FactorDiagonal(a, k0, k1)) definite = false;
+        },
+        {}, {t.Id(k, k)}, true);
+    for (int i = k + 1; i < t.count; ++i) {
+      int r0 = t.Begin(i), r1 = t.End(i);
+      dag.Add(
+          [=, &definite] {
+            if (definite) SolveLowerTransposed(a, r0, r1, k0, k1);
+          },
+          {t.Id(k, k)}, {t.Id(i, k)}, true);
+    }
+    for (int j = k + 1; j < t.count; ++j) {
+      int c0 = t.Begin(j), c1 = t.End(j);
+      for (int i = j; i < t.count; ++i) {
+        int r0 = t.Begin(i), r1 = t.End(i);
+        dag.Add(
+            [=, &definite] {
+              if (!definite) return;
+              UpdateCholesky(a, r0, r1, c0, c1, k0, k1, i == j);
+            },
+            {t.Id(i, k), t.Id(j, k)}, {t.Id(i, j)}, j == k + 1);
+      }
+    }
+  }
+  dag.Run();
+  return definite;
+}
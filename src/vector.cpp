@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cmath>
+
+#include "s21_vector.h"
+
+S21Vector::S21Vector() : size_(0), data_(nullptr) {}
+
+S21Vector::S21Vector(int size) : size_(size), data_(nullptr) {
+  if (size < 1) {
+    throw std::invalid_argument("Vector size must be positive");
+  }
+  data_ = new double[size_]();
+}
+
+S21Vector::S21Vector(const S21Vector& other)
+    : size_(other.size_), data_(nullptr) {
+  if (other.data_ != nullptr) {
+    data_ = new double[size_];
+    std::copy(other.data_, other.data_ + size_, data_);
+  }
+}
+
+S21Vector::S21Vector(S21Vector&& other) noexcept
+    : size_(other.size_), data_(other.data_) {
+  other.size_ = 0;
+  other.data_ = nullptr;
+}
+
+S21Vector::~S21Vector() { delete[] data_; }
+
+bool S21Vector::EqVector(const S21Vector& other) const {
+  if (size_ != other.size_) return false;
+  for (int i = 0; i < size_; ++i) {
+    if (std::fabs(data_[i] - other.data_[i]) > 1e-7) return false;
+  }
+  return true;
+}
+
+void S21Vector::Fill(double value) { std::fill(data_, data_ + size_, value); }
+
+S21Vector& S21Vector::operator=(const S21Vector& other) {
+  if (this != &other) {
+    S21Vector temp(other);
+    std::swap(size_, temp.size_);
+    std::swap(data_, temp.data_);
+  }
+  return *this;
+}
+
+S21Vector& S21Vector::operator=(S21Vector&& other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(data_, other.data_);
+  return *this;
+}
+
+bool S21Vector::operator==(const S21Vector& other) const {
+  return EqVector(other);
+}
+
+double& S21Vector::operator()(int i) {
+  if (i < 0 || i >= size_) throw std::out_of_range("Index out of bounds");
+  return data_[i];
+}
+
+double S21Vector::operator()(int i) const {
+  if (i < 0 || i >= size_) throw std::out_of_range("Index out of bounds");
+  return data_[i];
+}